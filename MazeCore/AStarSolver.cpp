@@ -0,0 +1,156 @@
+#include "AStarSolver.h"
+#include "Maze.h"
+
+AStarSolver::AStarSolver(const Maze& maze) : maze(maze)
+{
+}
+
+void AStarSolver::Start(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	this->startCell = startCell;
+	this->endCell = endCell;
+
+	endX = maze.GetCellX(endCell);
+	endY = maze.GetCellY(endCell);
+
+	/* Only the cells reached by the last search are reset, so queries with nearby cells stay cheap on big mazes */
+	if ((int)parents.size() != maze.GetCellCount()) {
+		parents.assign(maze.GetCellCount(), UNVISITED);
+		costs.assign(maze.GetCellCount(), INT_MAX);
+	}
+	else {
+		for (const auto& cell : reachedCells) {
+			parents[cell] = UNVISITED;
+			costs[cell] = INT_MAX;
+		}
+	}
+	reachedCells.clear();
+
+	for (auto& bucket : buckets)
+		bucket.clear();
+	openCount = 0;
+
+	path.clear();
+	pathFound = false;
+	expandedCount = 0;
+	pushedCount = 0;
+	headCell = Utils::INVALID_CELL;
+
+	parents[startCell] = ROOT_PARENT;
+	costs[startCell] = 0;
+	reachedCells.push_back(startCell);
+	currentF = GetHeuristic(startCell);
+	Push(startCell, currentF);
+
+	searching = true;
+}
+
+/*
+PURPOSE: Expands the newest cell of the lowest f bucket.
+	A cell may be pushed again with a smaller g before it is expanded, the old entries are skipped when they are popped.
+*/
+bool AStarSolver::Step()
+{
+	if (!searching)
+		return false;
+
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+
+	while (openCount > 0) {
+		std::vector<Utils::CellIndex>& bucket = buckets[currentF & (BUCKET_COUNT - 1)];
+
+		if (bucket.empty()) {
+			currentF++;
+			continue;
+		}
+
+		Utils::CellIndex cell = bucket.back();
+		bucket.pop_back();
+		openCount--;
+
+		/* Stale entry, the cell was expanded already or pushed again with a better g */
+		if ((parents[cell] & CLOSED) || costs[cell] + GetHeuristic(cell) != currentF)
+			continue;
+
+		parents[cell] |= CLOSED;
+		headCell = cell;
+		expandedCount++;
+
+		if (cell == endCell) {
+			TraceParents(parents, width, endCell, path);
+			std::reverse(path.begin(), path.end());
+
+			pathFound = true;
+			searching = false;
+			return false;
+		}
+
+		const int x = cell % width;
+		const int nextCost = costs[cell] + 1;
+
+		/* Same order as Utils::GetDirection */
+		const Utils::CellIndex neighbors[4] = {
+			cell >= width ? cell - width : Utils::INVALID_CELL,
+			cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+			x > 0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (int i = 0; i < 4; ++i) {
+			Utils::CellIndex neighbor = neighbors[i];
+
+			if (neighbor == Utils::INVALID_CELL || nextCost >= costs[neighbor] || maze.IsWall(neighbor))
+				continue;
+
+			if (costs[neighbor] == INT_MAX)
+				reachedCells.push_back(neighbor);
+
+			costs[neighbor] = nextCost;
+			parents[neighbor] = (uint8_t)(i + 1);
+			Push(neighbor, nextCost + GetHeuristic(neighbor));
+		}
+
+		return true;
+	}
+
+	searching = false;
+	headCell = Utils::INVALID_CELL;
+	return false;
+}
+
+bool AStarSolver::Solve(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	Start(startCell, endCell);
+	while (AStarSolver::Step()); // Qualified, so the loop doesn't go through the vtable
+	return pathFound;
+}
+
+Utils::SearchSide AStarSolver::GetVisitedSide(Utils::CellIndex cell) const
+{
+	if (parents.empty() || parents[cell] == UNVISITED)
+		return Utils::SearchSide::None;
+	return Utils::SearchSide::Start;
+}
+
+void AStarSolver::GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& /* endFrontier */) const
+{
+	for (const auto& bucket : buckets) {
+		for (const auto& cell : bucket) {
+			if (!(parents[cell] & CLOSED))
+				startFrontier.push_back(cell);
+		}
+	}
+}
+
+int AStarSolver::GetHeuristic(Utils::CellIndex cell) const
+{
+	return std::abs(maze.GetCellX(cell) - endX) + std::abs(maze.GetCellY(cell) - endY);
+}
+
+void AStarSolver::Push(Utils::CellIndex cell, int f)
+{
+	buckets[f & (BUCKET_COUNT - 1)].push_back(cell);
+	openCount++;
+	pushedCount++;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+/*
+
+AStarSolver class that finds a shortest path with A* search, Manhattan distance to the end cell is the heuristic.
+Costs are integers and every move costs 1, so a move changes f = g + h by 0 or 2 and f never decreases.
+The open list is a bucket queue of f values instead of a binary heap, only the buckets of f, f + 1 and f + 2 can hold cells,
+so a ring of four buckets is enough and both push and pop are O(1).
+
+*/
+
+#include "StepSolver.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class AStarSolver final : public StepSolver
+{
+public:
+	AStarSolver() = delete;
+	AStarSolver(const Maze& maze);
+
+	AStarSolver(const AStarSolver& other) = delete;
+	AStarSolver& operator=(const AStarSolver& other) = delete;
+
+	void Start(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+	bool Step() override;
+	bool Solve(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+
+	bool IsPathFound() const override { return pathFound; }
+	const std::vector<Utils::CellIndex>& GetPath() const override { return path; }
+
+	uint64_t GetExpandedCount() const override { return expandedCount; }
+	uint64_t GetPushedCount() const { return pushedCount; } // Cells put into the open list, including the stale ones
+
+	Utils::CellIndex GetHeadCell() const override { return headCell; }
+	Utils::SearchSide GetVisitedSide(Utils::CellIndex cell) const override;
+	void GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& endFrontier) const override;
+
+private:
+	int GetHeuristic(Utils::CellIndex cell) const;
+	void Push(Utils::CellIndex cell, int f);
+
+private:
+	static constexpr uint8_t CLOSED = 0x80; // Parent flag of the expanded cells
+	static constexpr int BUCKET_COUNT = 4;  // Power of two, bigger than the largest f step
+
+	const Maze& maze;
+
+	std::vector<uint8_t> parents;
+	std::vector<int> costs; // g, the best known distance from the start cell
+	std::vector<Utils::CellIndex> reachedCells; // Cells to reset before the next search
+
+	/* Bucket f % BUCKET_COUNT holds the cells pushed with that f, each bucket is a stack */
+	std::vector<Utils::CellIndex> buckets[BUCKET_COUNT];
+	size_t openCount = 0;
+	int currentF = 0;
+
+	Utils::CellIndex startCell = Utils::INVALID_CELL;
+	Utils::CellIndex endCell = Utils::INVALID_CELL;
+	int endX = 0;
+	int endY = 0;
+
+	bool searching = false;
+	bool pathFound = false;
+	std::vector<Utils::CellIndex> path;
+
+	uint64_t expandedCount = 0;
+	uint64_t pushedCount = 0;
+
+	Utils::CellIndex headCell = Utils::INVALID_CELL;
+};
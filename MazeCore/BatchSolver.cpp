@@ -0,0 +1,183 @@
+#include "BatchSolver.h"
+#include "Maze.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+BatchSolver::BatchSolver(const Maze& maze, int threadCount) : maze(maze), threadCount(threadCount > 0 ? threadCount : 1)
+{
+}
+
+std::vector<BatchSolver::Result> BatchSolver::SolveBatch(std::span<const Query> queries, bool keepPaths)
+{
+	std::vector<Result> results(queries.size());
+	SolveBatch(queries, results, keepPaths);
+	return results;
+}
+
+/*
+PURPOSE: Every thread keeps one scratch for the whole batch and takes blocks of queries until none is left.
+	Results are written to the slot of their query, so the threads never write to the same place.
+*/
+void BatchSolver::SolveBatch(std::span<const Query> queries, std::span<Result> results, bool keepPaths)
+{
+	const size_t blockCount = (queries.size() + QUERY_BLOCK_SIZE - 1) / QUERY_BLOCK_SIZE;
+
+	std::atomic<size_t> nextBlock{ 0 };
+	std::atomic<uint64_t> batchExpandedCount{ 0 };
+
+	auto worker = [&]() {
+		std::unique_ptr<Scratch> scratch = AcquireScratch();
+		uint64_t count = 0;
+
+		for (size_t block = nextBlock++; block < blockCount; block = nextBlock++) {
+			const size_t end = std::min((block + 1) * QUERY_BLOCK_SIZE, queries.size());
+
+			for (size_t i = block * QUERY_BLOCK_SIZE; i < end; ++i)
+				count += Solve(queries[i], results[i], keepPaths, *scratch);
+		}
+
+		batchExpandedCount += count;
+		ReleaseScratch(std::move(scratch));
+	};
+
+	size_t workerCount = (size_t)threadCount < blockCount ? (size_t)threadCount : blockCount;
+
+	std::vector<std::thread> workers;
+
+	for (size_t i = 1; i < workerCount; ++i)
+		workers.emplace_back(worker);
+
+	worker(); // The calling thread works too
+
+	for (auto& thread : workers)
+		thread.join();
+
+	expandedCount = batchExpandedCount;
+}
+
+void BatchSolver::DecodePath(const Maze& maze, const Query& query, const Result& result, std::vector<Utils::CellIndex>& path)
+{
+	const int width = maze.GetWidth();
+	const Utils::CellIndex offsets[4] = { -width, width, -1, 1 }; // Same order as Utils::GetDirection
+
+	path.clear();
+
+	if (result.length < 0 || (int)result.moves.size() * 4 < result.length)
+		return;
+
+	Utils::CellIndex cell = query.startCell;
+	path.push_back(cell);
+
+	for (int i = 0; i < result.length; ++i) {
+		cell += offsets[(result.moves[i / 4] >> (2 * (i % 4))) & 0x3];
+		path.push_back(cell);
+	}
+}
+
+std::unique_ptr<BatchSolver::Scratch> BatchSolver::AcquireScratch()
+{
+	{
+		std::lock_guard<std::mutex> lock(scratchMutex);
+
+		if (!scratchPool.empty()) {
+			std::unique_ptr<Scratch> scratch = std::move(scratchPool.back());
+			scratchPool.pop_back();
+			return scratch;
+		}
+	}
+
+	/* Allocated outside of the lock, the pool grows up to the thread count */
+	std::unique_ptr<Scratch> scratch = std::make_unique<Scratch>();
+	scratch->parents.assign(maze.GetCellCount(), UNVISITED);
+	return scratch;
+}
+
+void BatchSolver::ReleaseScratch(std::unique_ptr<Scratch> scratch)
+{
+	std::lock_guard<std::mutex> lock(scratchMutex);
+	scratchPool.push_back(std::move(scratch));
+}
+
+/*
+PURPOSE: Breadth first search which stops when the end cell is entered, then walks the entered directions back to count the moves.
+	The visited cells are the queue too, their entered directions are cleared before returning.
+*/
+uint64_t BatchSolver::Solve(const Query& query, Result& result, bool keepPaths, Scratch& scratch) const
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+	const uint8_t* cells = maze.GetCellData();
+	const Utils::CellIndex offsets[4] = { -width, width, -1, 1 }; // Same order as Utils::GetDirection
+
+	const Utils::CellIndex startCell = query.startCell;
+	const Utils::CellIndex endCell = query.endCell;
+
+	result.length = -1;
+	result.moves.clear();
+
+	if ((cells[startCell] & Utils::CELL_WALL) || (cells[endCell] & Utils::CELL_WALL))
+		return 0;
+
+	if (startCell == endCell) {
+		result.length = 0;
+		return 0;
+	}
+
+	std::vector<uint8_t>& parents = scratch.parents;
+	std::vector<Utils::CellIndex>& visitedCells = scratch.visitedCells;
+
+	visitedCells.clear();
+	visitedCells.push_back(startCell);
+	parents[startCell] = ROOT_PARENT;
+
+	bool found = false;
+	size_t head = 0;
+
+	while (head < visitedCells.size() && !found) {
+		const Utils::CellIndex cell = visitedCells[head++];
+		const int x = cell % width;
+
+		const bool inside[4] = { cell >= width, cell + width < cellCount, x > 0, x + 1 < width };
+
+		for (int i = 0; i < 4; ++i) {
+			if (!inside[i])
+				continue;
+
+			const Utils::CellIndex neighbor = cell + offsets[i];
+
+			if (parents[neighbor] != UNVISITED || (cells[neighbor] & Utils::CELL_WALL))
+				continue;
+
+			parents[neighbor] = (uint8_t)(i + 1);
+			visitedCells.push_back(neighbor);
+
+			if (neighbor == endCell) {
+				found = true;
+				break;
+			}
+		}
+	}
+
+	if (found) {
+		int length = 0;
+		for (Utils::CellIndex cell = endCell; cell != startCell; cell -= offsets[parents[cell] - 1])
+			length++;
+
+		result.length = length;
+
+		if (keepPaths) {
+			result.moves.assign((length + 3) / 4, 0);
+
+			int move = length - 1;
+			for (Utils::CellIndex cell = endCell; cell != startCell; cell -= offsets[parents[cell] - 1], --move)
+				result.moves[move / 4] |= (uint8_t)((parents[cell] - 1) << (2 * (move % 4)));
+		}
+	}
+
+	for (Utils::CellIndex cell : visitedCells)
+		parents[cell] = UNVISITED;
+
+	return head;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+/*
+
+BatchSolver class that solves many start and end pairs of one maze at once with breadth first searches on all threads.
+The maze is only read, so queries are independent. Threads take blocks of queries from a shared counter,
+every thread takes a scratch (entered directions of the cells and the visited cells) from a pool at the start of a batch
+and gives it back at the end, so buffers of the maze size are allocated once per thread, not once per query.
+A search resets only the cells it visited, short queries don't pay for the size of the maze.
+
+Results hold the path length and optionally the path as 2 bit moves, four moves per byte.
+
+*/
+
+#include "Utils.h"
+
+#include <vector>
+#include <cstdint>
+#include <span>
+#include <memory>
+#include <mutex>
+
+class Maze;
+
+class BatchSolver
+{
+public:
+	struct Query
+	{
+		Utils::CellIndex startCell;
+		Utils::CellIndex endCell;
+	};
+
+	struct Result
+	{
+		int length = -1; // Moves from the start cell to the end cell, -1 if there is no path
+		std::vector<uint8_t> moves; // Only filled if paths are kept, move i is the Utils::GetDirection index in bits 2 * (i % 4) of byte i / 4
+	};
+
+public:
+	BatchSolver() = delete;
+	BatchSolver(const Maze& maze, int threadCount);
+
+	BatchSolver(const BatchSolver& other) = delete;
+	BatchSolver& operator=(const BatchSolver& other) = delete;
+
+	void SolveBatch(std::span<const Query> queries, std::span<Result> results, bool keepPaths); // <results> has a result for every query
+	std::vector<Result> SolveBatch(std::span<const Query> queries, bool keepPaths);
+
+	/* Cells of a kept path, start and end included */
+	static void DecodePath(const Maze& maze, const Query& query, const Result& result, std::vector<Utils::CellIndex>& path);
+
+	uint64_t GetExpandedCount() const { return expandedCount; } // Cells expanded by the last batch
+
+private:
+	struct Scratch
+	{
+		std::vector<uint8_t> parents; // UNVISITED for the cells the search didn't reach
+		std::vector<Utils::CellIndex> visitedCells; // Also the queue, cells are never removed until the search ends
+	};
+
+	std::unique_ptr<Scratch> AcquireScratch();
+	void ReleaseScratch(std::unique_ptr<Scratch> scratch);
+
+	uint64_t Solve(const Query& query, Result& result, bool keepPaths, Scratch& scratch) const; // Returns the expanded cells
+
+private:
+	static constexpr uint8_t UNVISITED = 0;
+	static constexpr uint8_t ROOT_PARENT = 5; // Other parents are the direction the cell was entered from as <direction index> + 1
+
+	static constexpr size_t QUERY_BLOCK_SIZE = 16;
+
+	const Maze& maze;
+	int threadCount = 1;
+
+	std::mutex scratchMutex;
+	std::vector<std::unique_ptr<Scratch>> scratchPool;
+
+	uint64_t expandedCount = 0;
+};
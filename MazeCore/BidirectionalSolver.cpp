@@ -0,0 +1,162 @@
+#include "BidirectionalSolver.h"
+#include "Maze.h"
+
+BidirectionalSolver::BidirectionalSolver(const Maze& maze) : maze(maze)
+{
+}
+
+void BidirectionalSolver::Start(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	this->startCell = startCell;
+	this->endCell = endCell;
+
+	/* Only the cells reached by the last search are reset, same as the breadth first solver */
+	if ((int)parents.size() != maze.GetCellCount()) {
+		parents.assign(maze.GetCellCount(), UNVISITED);
+	}
+	else {
+		for (const auto& cell : reachedCells)
+			parents[cell] = UNVISITED;
+	}
+	reachedCells.clear();
+
+	startQueue.Clear();
+	endQueue.Clear();
+
+	path.clear();
+	pathFound = false;
+	expandedCount = 0;
+	headCell = Utils::INVALID_CELL;
+
+	if (startCell == endCell) {
+		path.push_back(startCell);
+		pathFound = true;
+		searching = false;
+		return;
+	}
+
+	parents[startCell] = ROOT_PARENT;
+	startQueue.Push(startCell);
+
+	parents[endCell] = ROOT_PARENT | END_SIDE;
+	endQueue.Push(endCell);
+
+	reachedCells.push_back(startCell);
+	reachedCells.push_back(endCell);
+
+	layerRemaining = 0;
+	searching = true;
+}
+
+/*
+PURPOSE: Expands a single cell of the growing layer, the growing side is selected again when the layer is over
+*/
+bool BidirectionalSolver::Step()
+{
+	if (!searching)
+		return false;
+
+	if (layerRemaining == 0)
+		SelectGrowingSide();
+
+	CellQueue& queue = growingEndSide ? endQueue : startQueue;
+
+	/* One side ran out of cells without meeting the other, they are not connected */
+	if (queue.IsEmpty()) {
+		searching = false;
+		headCell = Utils::INVALID_CELL;
+		return false;
+	}
+
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+	const uint8_t side = growingEndSide ? END_SIDE : 0;
+
+	Utils::CellIndex cell = queue.Pop();
+	layerRemaining--;
+	headCell = cell;
+	expandedCount++;
+
+	const int x = cell % width;
+
+	/* Same order as Utils::GetDirection */
+	const Utils::CellIndex neighbors[4] = {
+		cell >= width ? cell - width : Utils::INVALID_CELL,
+		cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+		x > 0 ? cell - 1 : Utils::INVALID_CELL,
+		x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+	};
+
+	for (int i = 0; i < 4; ++i) {
+		Utils::CellIndex neighbor = neighbors[i];
+
+		if (neighbor == Utils::INVALID_CELL || maze.IsWall(neighbor))
+			continue;
+
+		if (parents[neighbor] != UNVISITED) {
+			/* Reached by the other side, this is the meeting */
+			if ((parents[neighbor] & END_SIDE) != side) {
+				BuildPath(cell, neighbor);
+				searching = false;
+				return false;
+			}
+			continue;
+		}
+
+		parents[neighbor] = (uint8_t)(i + 1) | side;
+		queue.Push(neighbor);
+		reachedCells.push_back(neighbor);
+	}
+
+	return true;
+}
+
+bool BidirectionalSolver::Solve(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	Start(startCell, endCell);
+	while (BidirectionalSolver::Step()); // Qualified, so the loop doesn't go through the vtable
+	return pathFound;
+}
+
+Utils::SearchSide BidirectionalSolver::GetVisitedSide(Utils::CellIndex cell) const
+{
+	if (parents.empty() || parents[cell] == UNVISITED)
+		return Utils::SearchSide::None;
+	return (parents[cell] & END_SIDE) ? Utils::SearchSide::End : Utils::SearchSide::Start;
+}
+
+void BidirectionalSolver::GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& endFrontier) const
+{
+	startQueue.CopyTo(startFrontier);
+	endQueue.CopyTo(endFrontier);
+}
+
+/*
+PURPOSE: The side with fewer cells in its next layer grows, an empty side is selected so the search can stop
+*/
+void BidirectionalSolver::SelectGrowingSide()
+{
+	growingEndSide = endQueue.GetSize() < startQueue.GetSize();
+
+	/* Queue holds exactly the next layer between layers */
+	layerRemaining = growingEndSide ? endQueue.GetSize() : startQueue.GetSize();
+}
+
+/*
+PURPOSE: Joins the parent chains of the meeting edge, the start side chain is reversed so the path starts from the start cell
+*/
+void BidirectionalSolver::BuildPath(Utils::CellIndex cell, Utils::CellIndex neighbor)
+{
+	const int width = maze.GetWidth();
+
+	Utils::CellIndex startSideCell = growingEndSide ? neighbor : cell;
+	Utils::CellIndex endSideCell = growingEndSide ? cell : neighbor;
+
+	path.clear();
+	TraceParents(parents, width, startSideCell, path);
+	std::reverse(path.begin(), path.end());
+
+	TraceParents(parents, width, endSideCell, path);
+
+	pathFound = true;
+}
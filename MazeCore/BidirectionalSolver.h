@@ -0,0 +1,71 @@
+#pragma once
+
+/*
+
+BidirectionalSolver class that finds a shortest path with two breadth first searches, one from each end, meeting in the middle.
+Searches grow a whole distance layer at a time and the side with the smaller frontier grows next.
+Cells are marked by the first search reaching them, so the first cell found marked by the other side is the meeting point.
+While a layer of one side grows, every meeting it can find has the same length, so stopping at the first one gives a shortest path,
+with or without loops in the maze. The path is the start side parent chain up to the meeting followed by the end side chain.
+
+*/
+
+#include "StepSolver.h"
+#include "CellQueue.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class BidirectionalSolver final : public StepSolver
+{
+public:
+	BidirectionalSolver() = delete;
+	BidirectionalSolver(const Maze& maze);
+
+	BidirectionalSolver(const BidirectionalSolver& other) = delete;
+	BidirectionalSolver& operator=(const BidirectionalSolver& other) = delete;
+
+	void Start(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+	bool Step() override;
+	bool Solve(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+
+	bool IsPathFound() const override { return pathFound; }
+	const std::vector<Utils::CellIndex>& GetPath() const override { return path; }
+
+	uint64_t GetExpandedCount() const override { return expandedCount; }
+
+	Utils::CellIndex GetHeadCell() const override { return headCell; }
+	Utils::SearchSide GetVisitedSide(Utils::CellIndex cell) const override;
+	void GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& endFrontier) const override;
+
+private:
+	void SelectGrowingSide();
+	void BuildPath(Utils::CellIndex cell, Utils::CellIndex neighbor); // Cells of the meeting edge
+
+private:
+	static constexpr uint8_t END_SIDE = 0x8; // Parent flag of the cells reached from the end cell
+
+	const Maze& maze;
+
+	std::vector<uint8_t> parents;
+	std::vector<Utils::CellIndex> reachedCells; // Cells of both sides to reset before the next search
+
+	CellQueue startQueue;
+	CellQueue endQueue;
+
+	bool growingEndSide = false;
+	size_t layerRemaining = 0; // Cells of the growing layer not expanded yet
+
+	Utils::CellIndex startCell = Utils::INVALID_CELL;
+	Utils::CellIndex endCell = Utils::INVALID_CELL;
+
+	bool searching = false;
+	bool pathFound = false;
+	std::vector<Utils::CellIndex> path;
+
+	uint64_t expandedCount = 0;
+
+	Utils::CellIndex headCell = Utils::INVALID_CELL;
+};
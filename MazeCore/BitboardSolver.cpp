@@ -0,0 +1,283 @@
+#include "BitboardSolver.h"
+#include "Maze.h"
+
+#include <bit>
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+BitboardSolver::BitboardSolver(const Maze& maze) : maze(maze)
+{
+}
+
+void BitboardSolver::Start(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	this->startCell = startCell;
+	this->endCell = endCell;
+
+	width = maze.GetWidth();
+	height = maze.GetHeight();
+
+	rowWords = (((size_t)width + 63) / 64 + 3) & ~(size_t)3;
+	rowStride = rowWords + 2;
+
+	const size_t wordCount = rowStride * (height + 2) + 1; // One more, so loading 4 words from the last side word stays inside
+
+	openBits.assign(wordCount, 0);
+	visitedBits.assign(wordCount, 0);
+	frontierBits.assign(wordCount, 0);
+	nextBits.assign(wordCount, 0);
+	parentLowBits.assign(wordCount, 0);
+	parentHighBits.assign(wordCount, 0);
+
+	for (int y = 0; y < height; ++y) {
+		uint64_t* row = &openBits[GetRowBegin(y)];
+		Utils::CellIndex rowCell = y * width;
+
+		for (int x = 0; x < width; ++x)
+			row[x / 64] |= (uint64_t)(maze.IsWall(rowCell + x) ? 0 : 1) << (x % 64);
+	}
+
+	rowStamps.assign(height, 0);
+	frontierRows.clear();
+	nextRows.clear();
+	frontierRanges.resize(height);
+	nextRanges.resize(height);
+	expandedRanges.resize(height);
+
+	path.clear();
+	pathFound = false;
+	expandedCount = 0;
+	layer = 0;
+
+	visitedBits[GetWord(startCell)] |= GetBit(startCell);
+	frontierBits[GetWord(startCell)] |= GetBit(startCell);
+	frontierRows.push_back(startCell / width);
+	frontierRanges[startCell / width] = { (startCell % width) / 64, (startCell % width) / 64 };
+	frontierSize = 1;
+
+	searching = true;
+
+	if (startCell == endCell) {
+		BuildPath();
+		searching = false;
+	}
+}
+
+/*
+PURPOSE: Expands the frontier words and the words around them in the rows of the frontier and the rows next to them,
+	the old frontier words are cleared so the buffers can be swapped
+*/
+bool BitboardSolver::Step()
+{
+	if (!searching)
+		return false;
+
+	if (frontierSize == 0) {
+		searching = false;
+		return false;
+	}
+
+	expandedCount += frontierSize;
+
+	const int stamp = layer + 1;
+
+	expandedRows.clear();
+
+	for (int frontierRow : frontierRows) {
+		/* A frontier word reaches one more word on both sides */
+		WordRange range = frontierRanges[frontierRow];
+		range.first = std::max(range.first - 1, 0);
+		range.last = std::min(range.last + 1, (int)rowWords - 1);
+
+		for (int y = std::max(frontierRow - 1, 0); y <= std::min(frontierRow + 1, height - 1); ++y) {
+			if (rowStamps[y] != stamp) {
+				rowStamps[y] = stamp;
+				expandedRows.push_back(y);
+				expandedRanges[y] = range;
+				continue;
+			}
+
+			expandedRanges[y].first = std::min(expandedRanges[y].first, range.first);
+			expandedRanges[y].last = std::max(expandedRanges[y].last, range.last);
+		}
+	}
+
+	nextRows.clear();
+	frontierSize = 0;
+
+	for (int y : expandedRows) {
+		int count = ExpandRow(y, expandedRanges[y]);
+
+		if (count > 0) {
+			nextRows.push_back(y);
+			frontierSize += count;
+		}
+	}
+
+	for (int y : frontierRows) {
+		const WordRange& range = frontierRanges[y];
+		std::fill_n(frontierBits.begin() + GetRowBegin(y) + range.first, range.last - range.first + 1, 0);
+	}
+
+	std::swap(frontierBits, nextBits);
+	std::swap(frontierRows, nextRows);
+	std::swap(frontierRanges, nextRanges);
+
+	layer++;
+
+	if ((visitedBits[GetWord(endCell)] & GetBit(endCell)) != 0) {
+		BuildPath();
+		searching = false;
+		return false;
+	}
+
+	return true;
+}
+
+bool BitboardSolver::Solve(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	Start(startCell, endCell);
+	while (BitboardSolver::Step()); // Qualified, so the loop doesn't go through the vtable
+	return pathFound;
+}
+
+Utils::SearchSide BitboardSolver::GetVisitedSide(Utils::CellIndex cell) const
+{
+	if (visitedBits.empty() || (visitedBits[GetWord(cell)] & GetBit(cell)) == 0)
+		return Utils::SearchSide::None;
+	return Utils::SearchSide::Start;
+}
+
+void BitboardSolver::GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& /* endFrontier */) const
+{
+	for (int y : frontierRows) {
+		for (int i = frontierRanges[y].first; i <= frontierRanges[y].last; ++i) {
+			for (uint64_t bits = frontierBits[GetRowBegin(y) + i]; bits != 0; bits &= bits - 1)
+				startFrontier.push_back(y * width + i * 64 + std::countr_zero(bits));
+		}
+	}
+}
+
+/*
+PURPOSE: Reached cells are the open, unvisited cells with a frontier cell on their left, right, above or below.
+	When more than one frontier cell reaches a cell the parent is picked in the order below, above, right, left,
+	which is the lowest entered direction, like the other breadth first solvers.
+*/
+int BitboardSolver::ExpandRow(int y, WordRange range)
+{
+	const size_t rowBegin = GetRowBegin(y);
+	const uint64_t* frontier = frontierBits.data();
+	const uint64_t* open = openBits.data();
+	uint64_t* visited = visitedBits.data();
+	uint64_t* next = nextBits.data();
+	uint64_t* parentLow = parentLowBits.data();
+	uint64_t* parentHigh = parentHighBits.data();
+
+	int i = range.first;
+
+#if defined(__AVX2__)
+	/* Whole groups of 4 words, rows are a multiple of 4 words long */
+	for (i &= ~3; i <= range.last; i += 4) {
+		const size_t word = rowBegin + i;
+
+		__m256i cells = _mm256_loadu_si256((const __m256i*)(frontier + word));
+		__m256i leftWords = _mm256_loadu_si256((const __m256i*)(frontier + word - 1));
+		__m256i rightWords = _mm256_loadu_si256((const __m256i*)(frontier + word + 1));
+		__m256i above = _mm256_loadu_si256((const __m256i*)(frontier + word - rowStride));
+		__m256i below = _mm256_loadu_si256((const __m256i*)(frontier + word + rowStride));
+
+		__m256i fromLeft = _mm256_or_si256(_mm256_slli_epi64(cells, 1), _mm256_srli_epi64(leftWords, 63));
+		__m256i fromRight = _mm256_or_si256(_mm256_srli_epi64(cells, 1), _mm256_slli_epi64(rightWords, 63));
+
+		__m256i reached = _mm256_or_si256(_mm256_or_si256(fromLeft, fromRight), _mm256_or_si256(above, below));
+		__m256i visitedWords = _mm256_loadu_si256((const __m256i*)(visited + word));
+		reached = _mm256_andnot_si256(visitedWords, _mm256_and_si256(reached, _mm256_loadu_si256((const __m256i*)(open + word))));
+
+		__m256i up = _mm256_and_si256(reached, below);
+		__m256i rest = _mm256_andnot_si256(up, reached);
+		__m256i down = _mm256_and_si256(rest, above);
+		rest = _mm256_andnot_si256(down, rest);
+		__m256i left = _mm256_and_si256(rest, fromRight);
+		__m256i right = _mm256_andnot_si256(left, rest);
+
+		__m256i low = _mm256_or_si256(down, right);
+		__m256i high = _mm256_or_si256(left, right);
+
+		_mm256_storeu_si256((__m256i*)(parentLow + word), _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(parentLow + word)), low));
+		_mm256_storeu_si256((__m256i*)(parentHigh + word), _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(parentHigh + word)), high));
+		_mm256_storeu_si256((__m256i*)(visited + word), _mm256_or_si256(visitedWords, reached));
+		_mm256_storeu_si256((__m256i*)(next + word), reached);
+	}
+#endif
+
+	for (; i <= range.last; ++i) {
+		const size_t word = rowBegin + i;
+
+		uint64_t cells = frontier[word];
+		uint64_t fromLeft = (cells << 1) | (frontier[word - 1] >> 63);
+		uint64_t fromRight = (cells >> 1) | (frontier[word + 1] << 63);
+		uint64_t above = frontier[word - rowStride];
+		uint64_t below = frontier[word + rowStride];
+
+		uint64_t reached = (fromLeft | fromRight | above | below) & open[word] & ~visited[word];
+
+		uint64_t up = reached & below;
+		uint64_t rest = reached & ~up;
+		uint64_t down = rest & above;
+		rest &= ~down;
+		uint64_t left = rest & fromRight;
+		uint64_t right = rest & ~left;
+
+		parentLow[word] |= down | right;
+		parentHigh[word] |= left | right;
+		visited[word] |= reached;
+		next[word] = reached;
+	}
+
+	/* Range of the next frontier words in this row */
+	int count = 0;
+	WordRange& nextRange = nextRanges[y];
+	nextRange = { (int)rowWords, -1 };
+
+	for (i = range.first; i <= range.last; ++i) {
+		uint64_t bits = next[rowBegin + i];
+
+		if (bits == 0)
+			continue;
+
+		count += std::popcount(bits);
+		nextRange.first = std::min(nextRange.first, i);
+		nextRange.last = i;
+	}
+
+	return count;
+}
+
+/*
+PURPOSE: Walks the entered directions back from the end cell, then reverses the cells so the path starts from the start cell
+*/
+void BitboardSolver::BuildPath()
+{
+	const int offsets[4] = { -width, width, -1, 1 }; // Same order as Utils::GetDirection
+
+	path.clear();
+
+	for (Utils::CellIndex cell = endCell; ; ) {
+		path.push_back(cell);
+
+		if (cell == startCell)
+			break;
+
+		size_t word = GetWord(cell);
+		uint64_t bit = GetBit(cell);
+		int direction = ((parentLowBits[word] & bit) != 0 ? 1 : 0) | ((parentHighBits[word] & bit) != 0 ? 2 : 0);
+
+		cell -= offsets[direction];
+	}
+
+	std::reverse(path.begin(), path.end());
+	pathFound = true;
+}
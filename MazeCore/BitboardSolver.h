@@ -0,0 +1,102 @@
+#pragma once
+
+/*
+
+BitboardSolver class, a breadth first search which keeps the maze and the frontier as one bitset per row.
+A step grows the frontier by one distance layer with word operations over whole rows: the frontier is shifted left and right,
+ORed with the frontier rows above and below, and masked with the open and unvisited bits, so 64 cells (256 with AVX2) are flooded at once.
+Only the words next to the frontier words are processed, so narrow corridors of perfect mazes don't pay for the whole grid every layer.
+
+The direction each cell was reached from is kept in two bit planes with the same layout, which is the whole parent map (2 bits per cell),
+the path is recovered by walking those back from the end cell.
+
+*/
+
+#include "StepSolver.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class BitboardSolver final : public StepSolver
+{
+public:
+	BitboardSolver() = delete;
+	BitboardSolver(const Maze& maze);
+
+	BitboardSolver(const BitboardSolver& other) = delete;
+	BitboardSolver& operator=(const BitboardSolver& other) = delete;
+
+	void Start(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+	bool Step() override; // Grows the frontier by one distance layer
+	bool Solve(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+
+	bool IsPathFound() const override { return pathFound; }
+	const std::vector<Utils::CellIndex>& GetPath() const override { return path; }
+
+	uint64_t GetExpandedCount() const override { return expandedCount; }
+	int GetLayerCount() const { return layer; } // Distance of the end cell once the path is found
+
+	Utils::CellIndex GetHeadCell() const override { return Utils::INVALID_CELL; } // A whole layer is expanded at once
+	Utils::SearchSide GetVisitedSide(Utils::CellIndex cell) const override;
+	void GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& endFrontier) const override;
+
+private:
+	struct WordRange
+	{
+		int first;
+		int last;
+	};
+
+	int ExpandRow(int y, WordRange range); // Writes the cells of row y reached from the frontier to the next frontier, returns their count
+	void BuildPath();
+
+	size_t GetWord(Utils::CellIndex cell) const { return GetRowBegin(cell / width) + (cell % width) / 64; }
+	uint64_t GetBit(Utils::CellIndex cell) const { return (uint64_t)1 << ((cell % width) % 64); }
+	size_t GetRowBegin(int y) const { return (size_t)(y + 1) * rowStride + 1; }
+
+private:
+	const Maze& maze;
+
+	int width = 0;
+	int height = 0;
+
+	/*
+	Rows are rowWords long (a multiple of 4 so AVX2 never needs a tail) with a zero word on both sides,
+	and there is a zero row above and below the maze, so shifts and the rows around the frontier can be read without bound checks.
+	*/
+	size_t rowWords = 0;
+	size_t rowStride = 0;
+
+	std::vector<uint64_t> openBits;
+	std::vector<uint64_t> visitedBits;
+	std::vector<uint64_t> frontierBits;
+	std::vector<uint64_t> nextBits;
+
+	/* Direction index the cell was entered with, low and high bit, same order as Utils::GetDirection */
+	std::vector<uint64_t> parentLowBits;
+	std::vector<uint64_t> parentHighBits;
+
+	/* Rows holding frontier cells, and the words of each row between its first and last frontier word */
+	std::vector<int> frontierRows;
+	std::vector<int> nextRows;
+	std::vector<WordRange> frontierRanges;
+	std::vector<WordRange> nextRanges;
+
+	std::vector<int> expandedRows;
+	std::vector<WordRange> expandedRanges;
+	std::vector<int> rowStamps; // Last layer a row was expanded in, so rows next to two frontier rows are expanded once
+
+	size_t frontierSize = 0;
+
+	Utils::CellIndex startCell = Utils::INVALID_CELL;
+	Utils::CellIndex endCell = Utils::INVALID_CELL;
+
+	bool searching = false;
+	bool pathFound = false;
+	std::vector<Utils::CellIndex> path;
+
+	uint64_t expandedCount = 0;
+	int layer = 0;
+};
@@ -0,0 +1,117 @@
+#include "BreadthFirstSolver.h"
+#include "Maze.h"
+
+BreadthFirstSolver::BreadthFirstSolver(const Maze& maze) : maze(maze)
+{
+}
+
+void BreadthFirstSolver::Start(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	this->startCell = startCell;
+	this->endCell = endCell;
+
+	/* Only the cells reached by the last search are reset, so queries with nearby cells stay cheap on big mazes */
+	if ((int)parents.size() != maze.GetCellCount()) {
+		parents.assign(maze.GetCellCount(), UNVISITED);
+	}
+	else {
+		for (const auto& cell : reachedCells)
+			parents[cell] = UNVISITED;
+	}
+	reachedCells.clear();
+
+	queue.Clear();
+
+	path.clear();
+	pathFound = false;
+	expandedCount = 0;
+	headCell = Utils::INVALID_CELL;
+
+	parents[startCell] = ROOT_PARENT;
+	reachedCells.push_back(startCell);
+	queue.Push(startCell);
+
+	searching = true;
+}
+
+/*
+PURPOSE: Expands the oldest cell of the queue, its unvisited open neighbors remember the direction they were entered from
+*/
+bool BreadthFirstSolver::Step()
+{
+	if (!searching)
+		return false;
+
+	if (queue.IsEmpty()) {
+		searching = false;
+		headCell = Utils::INVALID_CELL;
+		return false;
+	}
+
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+
+	Utils::CellIndex cell = queue.Pop();
+	headCell = cell;
+	expandedCount++;
+
+	if (cell == endCell) {
+		BuildPath();
+		searching = false;
+		return false;
+	}
+
+	const int x = cell % width;
+
+	/* Same order as Utils::GetDirection */
+	const Utils::CellIndex neighbors[4] = {
+		cell >= width ? cell - width : Utils::INVALID_CELL,
+		cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+		x > 0 ? cell - 1 : Utils::INVALID_CELL,
+		x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+	};
+
+	for (int i = 0; i < 4; ++i) {
+		Utils::CellIndex neighbor = neighbors[i];
+
+		if (neighbor == Utils::INVALID_CELL || parents[neighbor] != UNVISITED || maze.IsWall(neighbor))
+			continue;
+
+		parents[neighbor] = (uint8_t)(i + 1);
+		reachedCells.push_back(neighbor);
+		queue.Push(neighbor);
+	}
+
+	return true;
+}
+
+bool BreadthFirstSolver::Solve(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	Start(startCell, endCell);
+	while (BreadthFirstSolver::Step()); // Qualified, so the loop doesn't go through the vtable
+	return pathFound;
+}
+
+Utils::SearchSide BreadthFirstSolver::GetVisitedSide(Utils::CellIndex cell) const
+{
+	if (parents.empty() || parents[cell] == UNVISITED)
+		return Utils::SearchSide::None;
+	return Utils::SearchSide::Start;
+}
+
+void BreadthFirstSolver::GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& /* endFrontier */) const
+{
+	queue.CopyTo(startFrontier);
+}
+
+/*
+PURPOSE: Walks the entered directions back from the end cell, then reverses the cells so the path starts from the start cell
+*/
+void BreadthFirstSolver::BuildPath()
+{
+	path.clear();
+	TraceParents(parents, maze.GetWidth(), endCell, path);
+
+	std::reverse(path.begin(), path.end());
+	pathFound = true;
+}
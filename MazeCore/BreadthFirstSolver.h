@@ -0,0 +1,62 @@
+#pragma once
+
+/*
+
+BreadthFirstSolver class that finds a shortest path with breadth first search.
+The queue is a ring buffer of cell indices which only grows with the frontier (see CellQueue),
+every cell keeps the direction it was entered from in one byte, so the path is recovered by walking those back from the end.
+
+*/
+
+#include "StepSolver.h"
+#include "CellQueue.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class BreadthFirstSolver final : public StepSolver
+{
+public:
+	BreadthFirstSolver() = delete;
+	BreadthFirstSolver(const Maze& maze);
+
+	BreadthFirstSolver(const BreadthFirstSolver& other) = delete;
+	BreadthFirstSolver& operator=(const BreadthFirstSolver& other) = delete;
+
+	void Start(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+	bool Step() override;
+	bool Solve(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+
+	bool IsPathFound() const override { return pathFound; }
+	const std::vector<Utils::CellIndex>& GetPath() const override { return path; }
+
+	uint64_t GetExpandedCount() const override { return expandedCount; }
+
+	Utils::CellIndex GetHeadCell() const override { return headCell; }
+	Utils::SearchSide GetVisitedSide(Utils::CellIndex cell) const override;
+	void GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& endFrontier) const override;
+
+private:
+	void BuildPath();
+
+private:
+	const Maze& maze;
+
+	std::vector<uint8_t> parents;
+	std::vector<Utils::CellIndex> reachedCells; // Cells to reset before the next search
+
+	CellQueue queue;
+
+	Utils::CellIndex startCell = Utils::INVALID_CELL;
+	Utils::CellIndex endCell = Utils::INVALID_CELL;
+
+	bool searching = false;
+	bool pathFound = false;
+	std::vector<Utils::CellIndex> path;
+
+	uint64_t expandedCount = 0;
+
+	Utils::CellIndex headCell = Utils::INVALID_CELL;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+/*
+
+CellQueue class, a FIFO ring buffer of cell indices used by the breadth first searches.
+Capacity is a power of two and only grows when the queue is full, so it follows the frontier size instead of the maze size.
+
+*/
+
+#include "Utils.h"
+
+#include <vector>
+
+class CellQueue
+{
+public:
+	CellQueue() : cells(64) {}
+
+	void Clear() { head = 0; tail = 0; }
+
+	bool IsEmpty() const { return head == tail; }
+	size_t GetSize() const { return tail - head; }
+
+	void Push(Utils::CellIndex cell) {
+		if (tail - head == cells.size())
+			Grow();
+
+		cells[tail++ & (cells.size() - 1)] = cell;
+	}
+
+	Utils::CellIndex Pop() { return cells[head++ & (cells.size() - 1)]; }
+
+	void CopyTo(std::vector<Utils::CellIndex>& destination) const {
+		for (size_t i = head; i != tail; ++i)
+			destination.push_back(cells[i & (cells.size() - 1)]);
+	}
+
+private:
+	/* Unwraps the cells into a buffer twice as big */
+	void Grow() {
+		std::vector<Utils::CellIndex> grownCells(cells.size() * 2);
+
+		for (size_t i = head; i != tail; ++i)
+			grownCells[i - head] = cells[i & (cells.size() - 1)];
+
+		tail -= head;
+		head = 0;
+		cells.swap(grownCells);
+	}
+
+private:
+	std::vector<Utils::CellIndex> cells;
+
+	/* Positions only grow, they are masked on access */
+	size_t head = 0;
+	size_t tail = 0;
+};
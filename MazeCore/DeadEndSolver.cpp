@@ -0,0 +1,295 @@
+#include "DeadEndSolver.h"
+#include "Maze.h"
+
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+DeadEndSolver::DeadEndSolver(const Maze& maze, int threadCount) : maze(maze), threadCount(threadCount)
+{
+	if (this->threadCount < 1)
+		this->threadCount = 1;
+}
+
+void DeadEndSolver::Start(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	this->startCell = startCell;
+	this->endCell = endCell;
+
+	path.clear();
+	pathFound = false;
+	expandedCount = 0;
+
+	FindDeadEnds();
+	deadEndCount = deadEnds.size();
+
+	filling = true;
+}
+
+/*
+PURPOSE: Fills one cell of every corridor, the corridors which reached a junction that still has two open neighbors are done
+*/
+bool DeadEndSolver::Step()
+{
+	if (!filling)
+		return false;
+
+	if (deadEnds.empty()) {
+		filling = false;
+		BuildPath();
+		return false;
+	}
+
+	nextDeadEnds.clear();
+
+	for (Utils::CellIndex cell : deadEnds) {
+		Utils::CellIndex nextCell = FillCell(cell, false);
+		expandedCount++;
+
+		if (nextCell != Utils::INVALID_CELL)
+			nextDeadEnds.push_back(nextCell);
+	}
+
+	std::swap(deadEnds, nextDeadEnds);
+	return true;
+}
+
+bool DeadEndSolver::Solve(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	Start(startCell, endCell);
+
+	FillInParallel();
+	deadEnds.clear();
+
+	filling = false;
+	BuildPath();
+	return pathFound;
+}
+
+Utils::SearchSide DeadEndSolver::GetVisitedSide(Utils::CellIndex cell) const
+{
+	if (states.empty() || (states[cell] & FILLED) == 0 || maze.IsWall(cell))
+		return Utils::SearchSide::None;
+	return Utils::SearchSide::Start;
+}
+
+void DeadEndSolver::GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& /* endFrontier */) const
+{
+	startFrontier.insert(startFrontier.end(), deadEnds.begin(), deadEnds.end());
+}
+
+/*
+PURPOSE: Counts the open neighbors of every cell in blocks of rows, then collects the open cells with at most one.
+	Rows away from the border read the rows above and below without bound checks, so the loop has no branches and can be vectorized.
+	Dead ends are collected in block order, so they don't depend on the thread count.
+*/
+void DeadEndSolver::FindDeadEnds()
+{
+	const int width = maze.GetWidth();
+	const int height = maze.GetHeight();
+	const uint8_t* cells = maze.GetCellData();
+
+	states.resize(maze.GetCellCount());
+
+	auto GetState = [&](Utils::CellIndex cell) {
+		if (maze.IsWall(cell))
+			return FILLED;
+
+		const int x = cell % width;
+		const int y = cell / width;
+
+		uint8_t count = 0;
+		count += (y > 0 && !maze.IsWall(cell - width)) ? 1 : 0;
+		count += (y + 1 < height && !maze.IsWall(cell + width)) ? 1 : 0;
+		count += (x > 0 && !maze.IsWall(cell - 1)) ? 1 : 0;
+		count += (x + 1 < width && !maze.IsWall(cell + 1)) ? 1 : 0;
+		return count;
+	};
+
+	size_t blockCount = ((size_t)height + ROW_BLOCK_SIZE - 1) / ROW_BLOCK_SIZE;
+	std::vector<std::vector<Utils::CellIndex>> blockDeadEnds(blockCount);
+
+	RunOnBlocks(blockCount, [&](size_t block) {
+		const int rowEnd = std::min((int)(block + 1) * ROW_BLOCK_SIZE, height);
+
+		for (int y = (int)block * ROW_BLOCK_SIZE; y < rowEnd; ++y) {
+			const Utils::CellIndex rowBegin = y * width;
+			uint8_t* rowStates = &states[rowBegin];
+
+			if (y == 0 || y + 1 == height || width < 3) {
+				for (int x = 0; x < width; ++x)
+					rowStates[x] = GetState(rowBegin + x);
+			}
+			else {
+				const uint8_t* row = cells + rowBegin;
+				const uint8_t* above = row - width;
+				const uint8_t* below = row + width;
+
+				for (int x = 1; x + 1 < width; ++x) {
+					uint8_t wallCount = (uint8_t)((above[x] & Utils::CELL_WALL) + (below[x] & Utils::CELL_WALL) + (row[x - 1] & Utils::CELL_WALL) + (row[x + 1] & Utils::CELL_WALL));
+					rowStates[x] = (uint8_t)((4 - wallCount) | ((row[x] & Utils::CELL_WALL) * FILLED));
+				}
+
+				rowStates[0] = GetState(rowBegin);
+				rowStates[width - 1] = GetState(rowBegin + width - 1);
+			}
+
+			for (int x = 0; x < width; ++x) {
+				Utils::CellIndex cell = rowBegin + x;
+
+				if (rowStates[x] <= 1 && cell != startCell && cell != endCell)
+					blockDeadEnds[block].push_back(cell);
+			}
+		}
+	});
+
+	deadEnds.clear();
+	for (auto& cells : blockDeadEnds)
+		deadEnds.insert(deadEnds.end(), cells.begin(), cells.end());
+}
+
+/*
+PURPOSE: Every block of dead ends is filled up to the junctions by one thread,
+	the thread which decrements the count of a junction to one carries on with it
+*/
+void DeadEndSolver::FillInParallel()
+{
+	size_t blockCount = (deadEnds.size() + DEAD_END_BLOCK_SIZE - 1) / DEAD_END_BLOCK_SIZE;
+	const bool concurrent = threadCount > 1 && blockCount > 1; // Atomics only when another thread may fill the same corridor
+
+	std::vector<uint64_t> blockCounts(blockCount, 0);
+
+	RunOnBlocks(blockCount, [&](size_t block) {
+		size_t end = std::min((block + 1) * DEAD_END_BLOCK_SIZE, deadEnds.size());
+		uint64_t count = 0;
+
+		for (size_t i = block * DEAD_END_BLOCK_SIZE; i < end; ++i) {
+			for (Utils::CellIndex cell = deadEnds[i]; cell != Utils::INVALID_CELL; cell = FillCell(cell, concurrent))
+				count++;
+		}
+
+		blockCounts[block] = count;
+	});
+
+	for (uint64_t count : blockCounts)
+		expandedCount += count;
+}
+
+/*
+PURPOSE: Fills the cell and decrements the count of its only open neighbor which is not filled yet.
+	Filling is released before the decrement, so the thread continuing with the neighbor sees every neighbor filled before it.
+*/
+Utils::CellIndex DeadEndSolver::FillCell(Utils::CellIndex cell, bool concurrent)
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+	const int x = cell % width;
+
+	if (concurrent)
+		std::atomic_ref<uint8_t>(states[cell]).fetch_or(FILLED, std::memory_order_release);
+	else
+		states[cell] |= FILLED;
+
+	/* Same order as Utils::GetDirection */
+	const Utils::CellIndex neighbors[4] = {
+		cell >= width ? cell - width : Utils::INVALID_CELL,
+		cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+		x > 0 ? cell - 1 : Utils::INVALID_CELL,
+		x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+	};
+
+	Utils::CellIndex nextCell = Utils::INVALID_CELL;
+
+	for (Utils::CellIndex neighbor : neighbors) {
+		if (neighbor == Utils::INVALID_CELL)
+			continue;
+
+		uint8_t state = concurrent ? std::atomic_ref<uint8_t>(states[neighbor]).load(std::memory_order_acquire) : states[neighbor];
+
+		if ((state & FILLED) == 0) {
+			nextCell = neighbor;
+			break;
+		}
+	}
+
+	if (nextCell == Utils::INVALID_CELL)
+		return Utils::INVALID_CELL;
+
+	uint8_t previous = concurrent ? std::atomic_ref<uint8_t>(states[nextCell]).fetch_sub(1, std::memory_order_acq_rel) : states[nextCell]--;
+
+	if ((previous & FILLED) != 0 || (previous & COUNT_MASK) != 2 || nextCell == startCell || nextCell == endCell)
+		return Utils::INVALID_CELL;
+
+	return nextCell;
+}
+
+/*
+PURPOSE: Breadth first search from the start cell through the cells which are not filled
+*/
+void DeadEndSolver::BuildPath()
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+
+	path.clear();
+	pathFound = false;
+
+	parents.assign(cellCount, UNVISITED);
+	queue.Clear();
+
+	parents[startCell] = ROOT_PARENT;
+	queue.Push(startCell);
+
+	while (!queue.IsEmpty()) {
+		Utils::CellIndex cell = queue.Pop();
+
+		if (cell == endCell) {
+			TraceParents(parents, width, endCell, path);
+			std::reverse(path.begin(), path.end());
+			pathFound = true;
+			return;
+		}
+
+		const int x = cell % width;
+
+		/* Same order as Utils::GetDirection */
+		const Utils::CellIndex neighbors[4] = {
+			cell >= width ? cell - width : Utils::INVALID_CELL,
+			cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+			x > 0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (int i = 0; i < 4; ++i) {
+			Utils::CellIndex neighbor = neighbors[i];
+
+			if (neighbor == Utils::INVALID_CELL || parents[neighbor] != UNVISITED || (states[neighbor] & FILLED) != 0)
+				continue;
+
+			parents[neighbor] = (uint8_t)(i + 1);
+			queue.Push(neighbor);
+		}
+	}
+}
+
+void DeadEndSolver::RunOnBlocks(size_t blockCount, const std::function<void(size_t)>& function)
+{
+	std::atomic<size_t> nextBlock{ 0 };
+
+	auto worker = [&]() {
+		for (size_t block = nextBlock++; block < blockCount; block = nextBlock++)
+			function(block);
+	};
+
+	size_t workerCount = (size_t)threadCount < blockCount ? (size_t)threadCount : blockCount;
+
+	std::vector<std::thread> workers;
+
+	for (size_t i = 1; i < workerCount; ++i)
+		workers.emplace_back(worker);
+
+	worker(); // The calling thread works too
+
+	for (auto& thread : workers)
+		thread.join();
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+/*
+
+DeadEndSolver class that finds the path by filling dead ends.
+Every open cell counts its open neighbors in one pass over the rows, cells with one open neighbor are dead ends.
+A dead end is filled and the count of its open neighbor goes down, the neighbor becomes a dead end when its count drops to one,
+so every dead end fills its corridor up to the junction it joins. The start and end cells are never filled, what stays open holds the path.
+
+Its cost depends on the maze size only, not on where the start and end cells are.
+Solve() fills the corridors of dead end blocks on all threads, a junction is continued by the thread which decrements its count to one,
+stepping advances every corridor by one cell per step, so the visualizer shows a sweep from all dead ends at once.
+Both end with the same filled cells. A breadth first search through the cells left open gives the path,
+on a perfect maze those cells are only the path itself.
+
+*/
+
+#include "StepSolver.h"
+#include "CellQueue.h"
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+class Maze;
+
+class DeadEndSolver final : public StepSolver
+{
+public:
+	DeadEndSolver() = delete;
+	DeadEndSolver(const Maze& maze, int threadCount);
+
+	DeadEndSolver(const DeadEndSolver& other) = delete;
+	DeadEndSolver& operator=(const DeadEndSolver& other) = delete;
+
+	void Start(Utils::CellIndex startCell, Utils::CellIndex endCell) override; // Finds the dead ends
+	bool Step() override; // Fills one more cell of every corridor
+	bool Solve(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+
+	bool IsPathFound() const override { return pathFound; }
+	const std::vector<Utils::CellIndex>& GetPath() const override { return path; }
+
+	uint64_t GetExpandedCount() const override { return expandedCount; } // Filled cells
+	size_t GetDeadEndCount() const { return deadEndCount; }
+
+	Utils::CellIndex GetHeadCell() const override { return Utils::INVALID_CELL; } // Every corridor is filled at once
+	Utils::SearchSide GetVisitedSide(Utils::CellIndex cell) const override;
+	void GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& endFrontier) const override;
+
+private:
+	void FindDeadEnds();
+	void FillInParallel();
+	Utils::CellIndex FillCell(Utils::CellIndex cell, bool concurrent); // Returns the next dead end of the corridor or Utils::INVALID_CELL
+
+	void BuildPath();
+
+	/* Runs <function(block)> for every block, on the calling thread only if there is one block */
+	void RunOnBlocks(size_t blockCount, const std::function<void(size_t)>& function);
+
+private:
+	/* State byte of every cell, count of open neighbors which are not filled yet, walls are filled from the start */
+	static constexpr uint8_t COUNT_MASK = 0x7;
+	static constexpr uint8_t FILLED = 0x80;
+
+	static constexpr int ROW_BLOCK_SIZE = 64;
+	static constexpr size_t DEAD_END_BLOCK_SIZE = 1 << 10;
+
+	const Maze& maze;
+	int threadCount = 1;
+
+	std::vector<uint8_t> states;
+
+	std::vector<Utils::CellIndex> deadEnds; // Corridors being filled, stepping replaces every cell with the next one
+	std::vector<Utils::CellIndex> nextDeadEnds;
+	size_t deadEndCount = 0;
+
+	/* Breadth first search through the cells left open */
+	std::vector<uint8_t> parents;
+	CellQueue queue;
+
+	Utils::CellIndex startCell = Utils::INVALID_CELL;
+	Utils::CellIndex endCell = Utils::INVALID_CELL;
+
+	bool filling = false;
+	bool pathFound = false;
+	std::vector<Utils::CellIndex> path;
+
+	uint64_t expandedCount = 0;
+};
@@ -0,0 +1,135 @@
+#include "DijkstraSolver.h"
+#include "Maze.h"
+
+DijkstraSolver::DijkstraSolver(const Maze& maze) : maze(maze)
+{
+}
+
+void DijkstraSolver::Start(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	this->startCell = startCell;
+	this->endCell = endCell;
+
+	/* Only the cells reached by the last search are reset, same as A* */
+	if ((int)parents.size() != maze.GetCellCount()) {
+		parents.assign(maze.GetCellCount(), UNVISITED);
+		distances.assign(maze.GetCellCount(), UNREACHED);
+	}
+	else {
+		for (const auto& cell : reachedCells) {
+			parents[cell] = UNVISITED;
+			distances[cell] = UNREACHED;
+		}
+	}
+	reachedCells.clear();
+
+	openList.Clear();
+
+	path.clear();
+	pathFound = false;
+	expandedCount = 0;
+	pushedCount = 0;
+	headCell = Utils::INVALID_CELL;
+
+	parents[startCell] = ROOT_PARENT;
+	distances[startCell] = 0;
+	reachedCells.push_back(startCell);
+	openList.Push(0, startCell);
+	pushedCount++;
+
+	searching = true;
+}
+
+/*
+PURPOSE: Expands one cell with the smallest distance.
+	A cell may be pushed again with a smaller distance before it is expanded, the old entries are skipped when they are popped.
+*/
+bool DijkstraSolver::Step()
+{
+	if (!searching)
+		return false;
+
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+	const uint8_t* costs = maze.GetCostData(); // Null if every cell costs 1
+
+	while (!openList.IsEmpty()) {
+		RadixHeap::Entry entry = openList.Pop();
+		Utils::CellIndex cell = entry.cell;
+
+		/* Stale entry, the cell was pushed again with a smaller distance */
+		if (entry.key != distances[cell])
+			continue;
+
+		parents[cell] |= CLOSED;
+		headCell = cell;
+		expandedCount++;
+
+		if (cell == endCell) {
+			TraceParents(parents, width, endCell, path);
+			std::reverse(path.begin(), path.end());
+
+			pathFound = true;
+			searching = false;
+			return false;
+		}
+
+		const int x = cell % width;
+
+		/* Same order as Utils::GetDirection */
+		const Utils::CellIndex neighbors[4] = {
+			cell >= width ? cell - width : Utils::INVALID_CELL,
+			cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+			x > 0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (int i = 0; i < 4; ++i) {
+			Utils::CellIndex neighbor = neighbors[i];
+
+			if (neighbor == Utils::INVALID_CELL || maze.IsWall(neighbor))
+				continue;
+
+			const uint32_t nextDistance = entry.key + (costs ? costs[neighbor] : 1);
+
+			if (nextDistance >= distances[neighbor])
+				continue;
+
+			if (distances[neighbor] == UNREACHED)
+				reachedCells.push_back(neighbor);
+
+			distances[neighbor] = nextDistance;
+			parents[neighbor] = (uint8_t)(i + 1);
+			openList.Push(nextDistance, neighbor);
+			pushedCount++;
+		}
+
+		return true;
+	}
+
+	searching = false;
+	headCell = Utils::INVALID_CELL;
+	return false;
+}
+
+bool DijkstraSolver::Solve(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	Start(startCell, endCell);
+	while (DijkstraSolver::Step()); // Qualified, so the loop doesn't go through the vtable
+	return pathFound;
+}
+
+Utils::SearchSide DijkstraSolver::GetVisitedSide(Utils::CellIndex cell) const
+{
+	if (parents.empty() || parents[cell] == UNVISITED)
+		return Utils::SearchSide::None;
+	return Utils::SearchSide::Start;
+}
+
+void DijkstraSolver::GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& /* endFrontier */) const
+{
+	openList.ForEach([&](const RadixHeap::Entry& entry) {
+		if (!(parents[entry.cell] & CLOSED) && entry.key == distances[entry.cell])
+			startFrontier.push_back(entry.cell);
+	});
+}
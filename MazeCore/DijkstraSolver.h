@@ -0,0 +1,67 @@
+#pragma once
+
+/*
+
+DijkstraSolver class that finds a cheapest path on mazes with weighted cells, entering a cell costs its cost (see Maze::GetCellCost).
+Costs are small positive integers, so the open list is a radix heap instead of a binary heap. Distances only grow as cells are
+expanded, which is all a radix heap needs, and its push and pop don't depend on the size of the open list.
+Without cell costs every cell costs 1 and the path is a shortest path.
+
+*/
+
+#include "StepSolver.h"
+#include "RadixHeap.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class DijkstraSolver final : public StepSolver
+{
+public:
+	DijkstraSolver() = delete;
+	DijkstraSolver(const Maze& maze);
+
+	DijkstraSolver(const DijkstraSolver& other) = delete;
+	DijkstraSolver& operator=(const DijkstraSolver& other) = delete;
+
+	void Start(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+	bool Step() override;
+	bool Solve(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+
+	bool IsPathFound() const override { return pathFound; }
+	const std::vector<Utils::CellIndex>& GetPath() const override { return path; }
+	uint32_t GetPathCost() const { return pathFound ? distances[endCell] : 0; } // Sum of the costs of the path cells, the start cell excluded
+
+	uint64_t GetExpandedCount() const override { return expandedCount; }
+	uint64_t GetPushedCount() const { return pushedCount; } // Cells put into the open list, including the stale ones
+
+	Utils::CellIndex GetHeadCell() const override { return headCell; }
+	Utils::SearchSide GetVisitedSide(Utils::CellIndex cell) const override;
+	void GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& endFrontier) const override;
+
+private:
+	static constexpr uint8_t CLOSED = 0x80; // Parent flag of the expanded cells
+	static constexpr uint32_t UNREACHED = UINT32_MAX;
+
+	const Maze& maze;
+
+	std::vector<uint8_t> parents;
+	std::vector<uint32_t> distances; // Cost of the cheapest known path from the start cell
+	std::vector<Utils::CellIndex> reachedCells; // Cells to reset before the next search
+
+	RadixHeap openList;
+
+	Utils::CellIndex startCell = Utils::INVALID_CELL;
+	Utils::CellIndex endCell = Utils::INVALID_CELL;
+
+	bool searching = false;
+	bool pathFound = false;
+	std::vector<Utils::CellIndex> path;
+
+	uint64_t expandedCount = 0;
+	uint64_t pushedCount = 0;
+
+	Utils::CellIndex headCell = Utils::INVALID_CELL;
+};
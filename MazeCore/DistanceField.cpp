@@ -0,0 +1,104 @@
+#include "DistanceField.h"
+#include "Maze.h"
+
+#include <fstream>
+#include <algorithm>
+
+DistanceField::DistanceField(const Maze& maze) : maze(maze)
+{
+}
+
+/*
+PURPOSE: Breadth first search from the source cell over every reachable cell, the last cell taken from the queue is the farthest one
+*/
+void DistanceField::Compute(Utils::CellIndex sourceCell)
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+
+	this->sourceCell = sourceCell;
+
+	distances.assign(cellCount, -1);
+	queue.Clear();
+
+	distances[sourceCell] = 0;
+	queue.Push(sourceCell);
+
+	while (!queue.IsEmpty()) {
+		Utils::CellIndex cell = queue.Pop();
+		farthestCell = cell;
+
+		const int x = cell % width;
+		const int nextDistance = distances[cell] + 1;
+
+		/* Same order as Utils::GetDirection */
+		const Utils::CellIndex neighbors[4] = {
+			cell >= width ? cell - width : Utils::INVALID_CELL,
+			cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+			x > 0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (Utils::CellIndex neighbor : neighbors) {
+			if (neighbor == Utils::INVALID_CELL || distances[neighbor] >= 0 || maze.IsWall(neighbor))
+				continue;
+
+			distances[neighbor] = nextDistance;
+			queue.Push(neighbor);
+		}
+	}
+
+	maxDistance = distances[farthestCell];
+}
+
+int DistanceField::FindDiameter(Utils::CellIndex anyCell, Utils::CellIndex& cell0, Utils::CellIndex& cell1)
+{
+	Compute(anyCell);
+	cell0 = farthestCell;
+
+	Compute(cell0);
+	cell1 = farthestCell;
+
+	return maxDistance;
+}
+
+bool DistanceField::ExportPgm(const std::string& filePath) const
+{
+	if (!IsComputed())
+		return false;
+
+	std::ofstream file(filePath, std::ios::binary);
+
+	if (!file)
+		return false;
+
+	const int maxValue = 65535;
+	const double scale = maxDistance + 1 > maxValue ? (double)(maxValue - 1) / maxDistance : 1.0;
+	const int fileMaxValue = std::min(maxDistance + 1, maxValue);
+
+	/* Samples are one byte below 256, otherwise two bytes, big endian */
+	const int sampleSize = fileMaxValue < 256 ? 1 : 2;
+
+	file << "P5\n" << maze.GetWidth() << " " << maze.GetHeight() << "\n" << fileMaxValue << "\n";
+
+	std::vector<unsigned char> row((size_t)maze.GetWidth() * sampleSize);
+
+	for (int y = 0; y < maze.GetHeight(); ++y) {
+		for (int x = 0; x < maze.GetWidth(); ++x) {
+			int distance = distances[y * maze.GetWidth() + x];
+			int value = distance < 0 ? 0 : (int)(distance * scale) + 1;
+
+			if (sampleSize == 1) {
+				row[x] = (unsigned char)value;
+				continue;
+			}
+
+			row[x * 2] = (unsigned char)(value >> 8);
+			row[x * 2 + 1] = (unsigned char)(value & 0xFF);
+		}
+
+		file.write((const char*)row.data(), row.size());
+	}
+
+	return (bool)file;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+/*
+
+DistanceField class that keeps the distance of every cell from one source cell, computed by one breadth first search.
+On a perfect maze the cell farthest from any cell is one end of the longest path, so two searches find the diameter (double BFS),
+mazes with loops get a pair at least half as far apart as the real diameter.
+
+The field can be exported as a 16 bit binary PGM image, walls and unreachable cells are 0 and open cells are <distance> + 1,
+scaled down to fit in 16 bits when the maze is too deep for exact values.
+
+*/
+
+#include "Utils.h"
+#include "CellQueue.h"
+
+#include <vector>
+#include <string>
+
+class Maze;
+
+class DistanceField
+{
+public:
+	DistanceField() = delete;
+	DistanceField(const Maze& maze);
+
+	DistanceField(const DistanceField& other) = delete;
+	DistanceField& operator=(const DistanceField& other) = delete;
+
+	void Compute(Utils::CellIndex sourceCell);
+
+	/* Computes the field twice, from <anyCell> and then from the cell farthest from it, the field stays computed from <cell0> */
+	int FindDiameter(Utils::CellIndex anyCell, Utils::CellIndex& cell0, Utils::CellIndex& cell1);
+
+	bool IsComputed() const { return sourceCell != Utils::INVALID_CELL; }
+	Utils::CellIndex GetSourceCell() const { return sourceCell; }
+	int GetDistance(Utils::CellIndex cell) const { return distances[cell]; } // -1 if the cell can't be reached
+	const std::vector<int>& GetDistances() const { return distances; }
+
+	Utils::CellIndex GetFarthestCell() const { return farthestCell; }
+	int GetMaxDistance() const { return maxDistance; }
+
+	bool ExportPgm(const std::string& filePath) const; // Returns false if the file can't be written
+
+private:
+	const Maze& maze;
+
+	std::vector<int> distances;
+	CellQueue queue;
+
+	Utils::CellIndex sourceCell = Utils::INVALID_CELL;
+	Utils::CellIndex farthestCell = Utils::INVALID_CELL;
+	int maxDistance = 0;
+};
@@ -0,0 +1,167 @@
+#include "EllerGenerator.h"
+
+EllerGenerator::EllerGenerator(int w, int h) : width(w), height(h)
+{
+	/* Make sure the maze size is odd, same as Maze */
+	if (width % 2 == 0)
+		width--;
+
+	if (height % 2 == 0)
+		height--;
+
+	latticeWidth = (width - 1) / 2;
+
+	parent.resize(latticeWidth);
+	rightOpen.resize(latticeWidth);
+	downOpen.resize(latticeWidth);
+
+	downCount.resize(latticeWidth);
+	memberCount.resize(latticeWidth);
+	downCandidate.resize(latticeWidth);
+	nextRoot.resize(latticeWidth);
+
+	row.resize(width);
+}
+
+void EllerGenerator::Generate(Random& random, const RowSink& sink)
+{
+	const int latticeHeight = (height - 1) / 2;
+
+	/* Top border */
+	std::fill(row.begin(), row.end(), Utils::CELL_WALL);
+	sink(0, row);
+
+	/* Every cell of the first row is its own set */
+	for (int column = 0; column < latticeWidth; ++column)
+		parent[column] = column;
+
+	for (int latticeY = 0; latticeY < latticeHeight; ++latticeY) {
+		bool isLastRow = latticeY == latticeHeight - 1;
+
+		JoinRow(random, isLastRow);
+
+		if (isLastRow)
+			std::fill(downOpen.begin(), downOpen.end(), 0);
+		else
+			ChooseDownPassages(random);
+
+		/* Row of cells and horizontal passages */
+		std::fill(row.begin(), row.end(), Utils::CELL_WALL);
+
+		for (int column = 0; column < latticeWidth; ++column) {
+			row[2 * column + 1] = 0;
+
+			if (rightOpen[column])
+				row[2 * column + 2] = 0;
+		}
+
+		sink(2 * latticeY + 1, row);
+
+		/* Row of vertical passages, the last one is the bottom border */
+		std::fill(row.begin(), row.end(), Utils::CELL_WALL);
+
+		for (int column = 0; column < latticeWidth; ++column) {
+			if (downOpen[column])
+				row[2 * column + 1] = 0;
+		}
+
+		sink(2 * latticeY + 2, row);
+
+		if (!isLastRow)
+			CarryToNextRow();
+	}
+}
+
+/*
+PURPOSE: Randomly joins neighbor cells which are in different sets, the last row joins all of them so the maze is connected
+*/
+void EllerGenerator::JoinRow(Random& random, bool isLastRow)
+{
+	for (int column = 0; column < latticeWidth; ++column)
+		rightOpen[column] = 0;
+
+	for (int column = 0; column + 1 < latticeWidth; ++column) {
+		if (FindSet(column) == FindSet(column + 1))
+			continue;
+
+		if (isLastRow || random.NextInt(2) == 0) {
+			UnionSets(column, column + 1);
+			rightOpen[column] = 1;
+		}
+	}
+}
+
+/*
+PURPOSE: Every cell goes down with 1/2 chance, then each set without any passage down gets one from a uniformly chosen member
+*/
+void EllerGenerator::ChooseDownPassages(Random& random)
+{
+	for (int column = 0; column < latticeWidth; ++column) {
+		downCount[column] = 0;
+		memberCount[column] = 0;
+	}
+
+	for (int column = 0; column < latticeWidth; ++column) {
+		int root = FindSet(column);
+
+		downOpen[column] = (uint8_t)random.NextInt(2);
+		downCount[root] += downOpen[column];
+
+		/* Reservoir sampling keeps one uniformly chosen member per set */
+		memberCount[root]++;
+		if (random.NextInt(memberCount[root]) == 0)
+			downCandidate[root] = column;
+	}
+
+	for (int column = 0; column < latticeWidth; ++column) {
+		if (parent[column] == column && downCount[column] == 0)
+			downOpen[downCandidate[column]] = 1;
+	}
+}
+
+/*
+PURPOSE: Builds the sets of the next row, cells below a passage keep their set and the others start a new one
+*/
+void EllerGenerator::CarryToNextRow()
+{
+	/* First column below a passage becomes the new root of its set */
+	for (int column = 0; column < latticeWidth; ++column)
+		nextRoot[column] = -1;
+
+	for (int column = 0; column < latticeWidth; ++column) {
+		if (!downOpen[column])
+			continue;
+
+		int root = FindSet(column);
+
+		if (nextRoot[root] == -1)
+			nextRoot[root] = column;
+
+		downCandidate[column] = nextRoot[root]; // Reused as scratch for the new parents
+	}
+
+	for (int column = 0; column < latticeWidth; ++column)
+		parent[column] = downOpen[column] ? downCandidate[column] : column;
+}
+
+int EllerGenerator::FindSet(int column)
+{
+	/* Path halving */
+	while (parent[column] != column) {
+		parent[column] = parent[parent[column]];
+		column = parent[column];
+	}
+	return column;
+}
+
+void EllerGenerator::UnionSets(int column0, int column1)
+{
+	int root0 = FindSet(column0);
+	int root1 = FindSet(column1);
+
+	/* Smaller column stays the root, so roots are stable and the result is deterministic */
+	if (root0 < root1)
+		parent[root1] = root0;
+	else if (root1 < root0)
+		parent[root0] = root1;
+}
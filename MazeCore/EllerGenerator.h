@@ -0,0 +1,62 @@
+#pragma once
+
+/*
+
+EllerGenerator class that generates a perfect maze row by row with Eller's algorithm.
+Only the current row and its set labels are kept in memory, so the memory use is O(width) whatever the height is.
+Rows are emitted in order through a sink callback with the same one byte cell state encoding used by Maze,
+so they can be copied into a Maze for the solvers or written straight to disk.
+
+*/
+
+#include "Utils.h"
+#include "Random.h"
+
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+class EllerGenerator
+{
+public:
+	/* Receives row y (0 is the first row) with <width> cell states */
+	typedef std::function<void(int y, const std::vector<uint8_t>& row)> RowSink;
+
+	EllerGenerator() = delete;
+	EllerGenerator(int w, int h);
+
+	EllerGenerator(const EllerGenerator& other) = delete;
+	EllerGenerator& operator=(const EllerGenerator& other) = delete;
+
+	void Generate(Random& random, const RowSink& sink);
+
+	int GetWidth() const { return width; }
+	int GetHeight() const { return height; }
+
+private:
+	void JoinRow(Random& random, bool isLastRow);
+	void ChooseDownPassages(Random& random);
+	void CarryToNextRow();
+
+	/* Union-find over the lattice columns of the current row */
+	int FindSet(int column);
+	void UnionSets(int column0, int column1);
+
+private:
+	int width;
+	int height;
+
+	int latticeWidth; // Odd cells on a row
+
+	std::vector<int> parent;         // Set forest of the current row
+	std::vector<uint8_t> rightOpen;  // Passage between column and column + 1
+	std::vector<uint8_t> downOpen;   // Passage between column and the same column on the next row
+
+	/* Scratch arrays indexed by set root */
+	std::vector<int> downCount;
+	std::vector<int> memberCount;
+	std::vector<int> downCandidate;
+	std::vector<int> nextRoot;
+
+	std::vector<uint8_t> row; // Cell states of the row being emitted
+};
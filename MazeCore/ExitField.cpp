@@ -0,0 +1,98 @@
+#include "ExitField.h"
+#include "Maze.h"
+
+ExitField::ExitField(const Maze& maze) : maze(maze)
+{
+}
+
+/*
+PURPOSE: Breadth first search from all exits at once, a cell takes the owner of the cell it is reached from
+*/
+void ExitField::Compute(std::span<const Utils::CellIndex> exitCells)
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+
+	this->exitCells.assign(exitCells.begin(), exitCells.end());
+
+	owners.assign(cellCount, -1);
+	distances.assign(cellCount, -1);
+	queue.Clear();
+
+	for (int exit = 0; exit < (int)exitCells.size(); ++exit) {
+		Utils::CellIndex cell = exitCells[exit];
+
+		/* An exit listed twice keeps its first index */
+		if (maze.IsWall(cell) || owners[cell] != -1)
+			continue;
+
+		owners[cell] = exit;
+		distances[cell] = 0;
+		queue.Push(cell);
+	}
+
+	while (!queue.IsEmpty()) {
+		Utils::CellIndex cell = queue.Pop();
+
+		const int x = cell % width;
+		const int owner = owners[cell];
+		const int nextDistance = distances[cell] + 1;
+
+		/* Same order as Utils::GetDirection */
+		const Utils::CellIndex neighbors[4] = {
+			cell >= width ? cell - width : Utils::INVALID_CELL,
+			cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+			x > 0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (Utils::CellIndex neighbor : neighbors) {
+			if (neighbor == Utils::INVALID_CELL || distances[neighbor] >= 0 || maze.IsWall(neighbor))
+				continue;
+
+			owners[neighbor] = owner;
+			distances[neighbor] = nextDistance;
+			queue.Push(neighbor);
+		}
+	}
+}
+
+/*
+PURPOSE: Steps to a neighbor of the same owner one closer to the exit until the exit, such a neighbor is the cell it was reached from or as near
+*/
+bool ExitField::GetNearestPath(Utils::CellIndex cell, std::vector<Utils::CellIndex>& path) const
+{
+	path.clear();
+
+	if (!IsComputed() || owners[cell] == -1)
+		return false;
+
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+	const int owner = owners[cell];
+
+	path.push_back(cell);
+
+	while (distances[cell] > 0) {
+		const int x = cell % width;
+		const int closerDistance = distances[cell] - 1;
+
+		const Utils::CellIndex neighbors[4] = {
+			cell >= width ? cell - width : Utils::INVALID_CELL,
+			cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+			x > 0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (Utils::CellIndex neighbor : neighbors) {
+			if (neighbor != Utils::INVALID_CELL && owners[neighbor] == owner && distances[neighbor] == closerDistance) {
+				cell = neighbor;
+				break;
+			}
+		}
+
+		path.push_back(cell);
+	}
+
+	return true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+/*
+
+ExitField class that finds the nearest exit of every cell with one breadth first search seeded with all exits at distance 0.
+The search grows from every exit at once, so each cell is reached first from its nearest exit and is owned by it,
+the owners split the maze into regions like a Voronoi diagram (ties go to the exit which comes first in the list).
+It replaces one search per exit with a single pass over the maze, and works the same for many sources and one target.
+
+The path from a cell to its nearest exit follows cells of the same owner one step closer each time, no parents are kept.
+
+*/
+
+#include "Utils.h"
+#include "CellQueue.h"
+
+#include <vector>
+#include <span>
+
+class Maze;
+
+class ExitField
+{
+public:
+	ExitField() = delete;
+	ExitField(const Maze& maze);
+
+	ExitField(const ExitField& other) = delete;
+	ExitField& operator=(const ExitField& other) = delete;
+
+	void Compute(std::span<const Utils::CellIndex> exitCells); // Walls in the list never own cells
+
+	bool IsComputed() const { return !owners.empty(); }
+	const std::vector<Utils::CellIndex>& GetExitCells() const { return exitCells; }
+
+	int GetOwner(Utils::CellIndex cell) const { return owners[cell]; } // Index of the nearest exit, -1 if no exit can be reached
+	int GetDistance(Utils::CellIndex cell) const { return distances[cell]; } // -1 if no exit can be reached
+
+	/* From the cell to its nearest exit, both included, returns false if no exit can be reached */
+	bool GetNearestPath(Utils::CellIndex cell, std::vector<Utils::CellIndex>& path) const;
+
+private:
+	const Maze& maze;
+
+	std::vector<Utils::CellIndex> exitCells;
+	std::vector<int> owners;
+	std::vector<int> distances;
+	CellQueue queue;
+};
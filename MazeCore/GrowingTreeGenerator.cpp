@@ -0,0 +1,172 @@
+#include "GrowingTreeGenerator.h"
+#include "Maze.h"
+
+GrowingTreeGenerator::GrowingTreeGenerator(Maze& maze, Utils::GrowingTreePolicy policy, float newestWeight) : maze(maze), policy(policy), newestWeight(newestWeight)
+{
+	latticeWidth = (maze.GetWidth() - 1) / 2;
+	latticeHeight = (maze.GetHeight() - 1) / 2;
+}
+
+void GrowingTreeGenerator::Start(Random& random)
+{
+	const int latticeCount = latticeWidth * latticeHeight;
+
+	activeCells.clear();
+	activeCells.reserve(latticeCount);
+	activeBegin = 0;
+	removedCount = 0;
+	headCell = Utils::INVALID_CELL;
+
+	if (latticeCount == 0)
+		return;
+
+	int startCell = random.NextInt(latticeCount);
+
+	maze.SetWall(GetLatticeCell(startCell), false);
+	activeCells.push_back(startCell);
+}
+
+/*
+PURPOSE: Carves from the selected active cell to a random unvisited neighbor, or retires the cell if there is none
+*/
+bool GrowingTreeGenerator::Step(Random& random)
+{
+	if (activeBegin == activeCells.size()) {
+		headCell = Utils::INVALID_CELL;
+		return false;
+	}
+
+	size_t position = SelectActive(random);
+	int latticeIndex = activeCells[position];
+
+	const int latticeX = latticeIndex % latticeWidth;
+	const int latticeY = latticeIndex / latticeWidth;
+
+	headCell = GetLatticeCell(latticeIndex);
+
+	/* Neighbor lattice cells are two cells away, same order as Utils::GetDirection */
+	const int rowStride = 2 * maze.GetWidth();
+
+	int neighbors[4];
+	Utils::CellIndex neighborCells[4];
+	int neighborCount = 0;
+
+	auto AddIfUnvisited = [&](bool inside, int neighbor, Utils::CellIndex neighborCell) {
+		if (inside && maze.IsWall(neighborCell)) {
+			neighbors[neighborCount] = neighbor;
+			neighborCells[neighborCount++] = neighborCell;
+		}
+	};
+
+	AddIfUnvisited(latticeY > 0, latticeIndex - latticeWidth, headCell - rowStride);
+	AddIfUnvisited(latticeY + 1 < latticeHeight, latticeIndex + latticeWidth, headCell + rowStride);
+	AddIfUnvisited(latticeX > 0, latticeIndex - 1, headCell - 2);
+	AddIfUnvisited(latticeX + 1 < latticeWidth, latticeIndex + 1, headCell + 2);
+
+	if (neighborCount == 0) {
+		RemoveActive(position);
+		return true;
+	}
+
+	int selected = random.NextInt(neighborCount);
+	int neighbor = neighbors[selected];
+	Utils::CellIndex neighborCell = neighborCells[selected];
+
+	/* Row-major indices make the wall the midpoint */
+	maze.SetWall((headCell + neighborCell) / 2, false);
+	maze.SetWall(neighborCell, false);
+
+	activeCells.push_back(neighbor);
+	headCell = neighborCell;
+
+	return true;
+}
+
+size_t GrowingTreeGenerator::SelectActive(Random& random)
+{
+	switch (policy)
+	{
+	case Utils::GrowingTreePolicy::Newest:
+		return activeCells.size() - 1;
+	case Utils::GrowingTreePolicy::Oldest:
+		return activeBegin;
+	case Utils::GrowingTreePolicy::Random:
+		return SelectRandomActive(random);
+	case Utils::GrowingTreePolicy::Mixed:
+		if (random.NextFloat() < newestWeight)
+			return activeCells.size() - 1;
+		return SelectRandomActive(random);
+	default:
+		return activeCells.size() - 1;
+	}
+}
+
+/*
+PURPOSE: Uniform among the active cells, removed cells left in the list by the mixed policy are drawn again.
+	They are never more than the active cells, so it takes less than two draws on average.
+*/
+size_t GrowingTreeGenerator::SelectRandomActive(Random& random)
+{
+	size_t position;
+
+	do {
+		position = activeBegin + random.NextInt((int)(activeCells.size() - activeBegin));
+	} while (activeCells[position] == REMOVED);
+
+	return position;
+}
+
+void GrowingTreeGenerator::RemoveActive(size_t position)
+{
+	if (position == activeCells.size() - 1) {
+		activeCells.pop_back();
+	}
+	else if (position == activeBegin) {
+		activeBegin++;
+	}
+	else if (policy == Utils::GrowingTreePolicy::Random) {
+		/* Order doesn't matter when every selection is random, the back cell fills the hole */
+		activeCells[position] = activeCells.back();
+		activeCells.pop_back();
+	}
+	else {
+		/* The mixed policy selects the newest cell too, so the order is kept and the cell is only marked */
+		activeCells[position] = REMOVED;
+		removedCount++;
+	}
+
+	/* Ends always hold active cells, so the back is the newest and the front is the oldest */
+	while (activeCells.size() > activeBegin && activeCells.back() == REMOVED) {
+		activeCells.pop_back();
+		removedCount--;
+	}
+	while (activeBegin < activeCells.size() && activeCells[activeBegin] == REMOVED) {
+		activeBegin++;
+		removedCount--;
+	}
+
+	if (removedCount > activeCells.size() - activeBegin - removedCount)
+		CompactActive();
+}
+
+/*
+PURPOSE: Drops the marked cells keeping the order, it runs once the marked cells are more than the active ones, so it is O(1) amortized per removal
+*/
+void GrowingTreeGenerator::CompactActive()
+{
+	size_t count = 0;
+
+	for (size_t i = activeBegin; i < activeCells.size(); ++i) {
+		if (activeCells[i] != REMOVED)
+			activeCells[count++] = activeCells[i];
+	}
+
+	activeCells.resize(count);
+	activeBegin = 0;
+	removedCount = 0;
+}
+
+Utils::CellIndex GrowingTreeGenerator::GetLatticeCell(int latticeIndex) const
+{
+	return maze.GetCellFromXY(2 * (latticeIndex % latticeWidth) + 1, 2 * (latticeIndex / latticeWidth) + 1);
+}
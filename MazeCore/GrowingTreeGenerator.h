@@ -0,0 +1,65 @@
+#pragma once
+
+/*
+
+GrowingTreeGenerator class that generates a perfect maze with the growing tree algorithm.
+A list of active cells is kept, each step selects one of them and carves to a random unvisited neighbor,
+cells without unvisited neighbors leave the list. The selection policy decides the texture of the maze,
+newest gives long corridors like the backtracker and random gives short dead ends like Prim's algorithm.
+
+The active list is a flat array of lattice indices in the order they were added, so the back is the newest cell and the front is the oldest.
+Every selection and removal is O(1): the newest cell is popped from the back, the oldest one is skipped by moving the front,
+and the random policy swap-removes any other cell with the back one, order doesn't matter to it.
+The mixed policy selects the newest cell too, so it marks the other cells removed instead of moving cells,
+random selections draw again on marked cells and the list is compacted once they are more than the active cells (O(1) amortized).
+
+*/
+
+#include "StepGenerator.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class GrowingTreeGenerator : public StepGenerator
+{
+public:
+	GrowingTreeGenerator() = delete;
+	GrowingTreeGenerator(Maze& maze, Utils::GrowingTreePolicy policy, float newestWeight);
+
+	GrowingTreeGenerator(const GrowingTreeGenerator& other) = delete;
+	GrowingTreeGenerator& operator=(const GrowingTreeGenerator& other) = delete;
+
+	void Start(Random& random) override;
+	bool Step(Random& random) override;
+
+	Utils::CellIndex GetHeadCell() const override { return headCell; }
+
+private:
+	size_t SelectActive(Random& random); // Position of the selected cell in the active list
+	size_t SelectRandomActive(Random& random);
+	void RemoveActive(size_t position);
+	void CompactActive();
+
+	/* Helpers */
+	Utils::CellIndex GetLatticeCell(int latticeIndex) const;
+
+private:
+	Maze& maze;
+
+	Utils::GrowingTreePolicy policy;
+	float newestWeight; // Chance of selecting the newest cell in the mixed policy, random otherwise
+
+	int latticeWidth;  // Odd cells on a row
+	int latticeHeight; // Odd cells on a column
+
+	static constexpr int REMOVED = -1; // Marked cell of the active list, only the mixed policy leaves them
+
+	/* Active cells are activeCells[activeBegin, activeCells.size()), every cell is pushed once so it never reallocates */
+	std::vector<int> activeCells;
+	size_t activeBegin = 0;
+	size_t removedCount = 0; // Marked cells between the ends
+
+	Utils::CellIndex headCell = Utils::INVALID_CELL;
+};
@@ -0,0 +1,538 @@
+#include "HierarchicalPathfinder.h"
+#include "Maze.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <functional>
+#include <thread>
+
+HierarchicalPathfinder::HierarchicalPathfinder(const Maze& maze, int clusterSize, int threadCount) : maze(maze), clusterSize(std::max(clusterSize, 2)), threadCount(std::max(threadCount, 1))
+{
+	clustersX = (maze.GetWidth() + this->clusterSize - 1) / this->clusterSize;
+	clustersY = (maze.GetHeight() + this->clusterSize - 1) / this->clusterSize;
+}
+
+void HierarchicalPathfinder::Build()
+{
+	clusters.assign((size_t)clustersX * clustersY, Cluster());
+	nodeBegins.assign(clusters.size() + 1, 0);
+
+	dirtyFlags.assign(clusters.size(), 1);
+	dirtyClusters.resize(clusters.size());
+
+	for (int cluster = 0; cluster < (int)clusters.size(); ++cluster)
+		dirtyClusters[cluster] = cluster;
+
+	Rebuild();
+}
+
+/*
+PURPOSE: The cluster of the cell is dirty, so is the cluster on the other side when the cell is on a cluster edge,
+	whether its entrance there is open depends on the cell
+*/
+void HierarchicalPathfinder::MarkDirty(Utils::CellIndex cell)
+{
+	const int x = maze.GetCellX(cell);
+	const int y = maze.GetCellY(cell);
+
+	auto Mark = [this](int x, int y) {
+		int cluster = (y / clusterSize) * clustersX + x / clusterSize;
+
+		if (!dirtyFlags[cluster]) {
+			dirtyFlags[cluster] = 1;
+			dirtyClusters.push_back(cluster);
+		}
+	};
+
+	Mark(x, y);
+
+	if (x % clusterSize == 0 && x > 0) Mark(x - 1, y);
+	if (x % clusterSize == clusterSize - 1 && x + 1 < maze.GetWidth()) Mark(x + 1, y);
+	if (y % clusterSize == 0 && y > 0) Mark(x, y - 1);
+	if (y % clusterSize == clusterSize - 1 && y + 1 < maze.GetHeight()) Mark(x, y + 1);
+
+	/* The last path may go through the cell, it can't be refined anymore */
+	distance = -1;
+	abstractPath.clear();
+}
+
+void HierarchicalPathfinder::Rebuild()
+{
+	if (dirtyClusters.empty())
+		return;
+
+	RunOnBlocks(dirtyClusters.size(), [this](size_t block) {
+		BuildCluster(dirtyClusters[block]);
+	});
+
+	for (int cluster : dirtyClusters)
+		dirtyFlags[cluster] = 0;
+
+	rebuiltClusterCount = (int)dirtyClusters.size();
+	dirtyClusters.clear();
+
+	/* Node ids move when a cluster gains or loses nodes, so the last query is reset with the old ids before the scratch is resized */
+	for (uint32_t node : reachedNodes)
+		distances[node] = INT_MAX;
+	reachedNodes.clear();
+
+	for (size_t cluster = 0; cluster < clusters.size(); ++cluster)
+		nodeBegins[cluster + 1] = nodeBegins[cluster] + (uint32_t)clusters[cluster].nodeCells.size();
+
+	nodeCount = nodeBegins.back();
+	distances.resize(nodeCount, INT_MAX);
+	parentCells.resize(nodeCount, Utils::INVALID_CELL);
+}
+
+size_t HierarchicalPathfinder::GetEdgeCount() const
+{
+	size_t edgeCount = 0;
+
+	for (const auto& cluster : clusters)
+		edgeCount += cluster.edges.size();
+
+	return edgeCount / 2; // Every edge is kept by both of its nodes
+}
+
+/*
+PURPOSE: Prunes the dead ends of the cluster which are not entrances, then walks every corridor between two nodes.
+	The local grid has a closed frame around the cluster, so neighbors need no bound checks.
+	Every thread builds its own clusters, the state is local to the call.
+*/
+void HierarchicalPathfinder::BuildCluster(int cluster)
+{
+	const int width = maze.GetWidth();
+	const int height = maze.GetHeight();
+	const uint8_t* cells = maze.GetCellData();
+
+	const Bounds bounds = GetBounds(cluster);
+	const int clusterWidth = bounds.x1 - bounds.x0;
+	const int clusterHeight = bounds.y1 - bounds.y0;
+	const int localWidth = clusterWidth + 2;
+	const int localCount = localWidth * (clusterHeight + 2);
+	const int offsets[4] = { -localWidth, localWidth, -1, 1 }; // Same order as Utils::GetDirection
+
+	/* Open cells which are not pruned have their open neighbor count, others stay CLOSED */
+	constexpr uint8_t CLOSED = 0xFF;
+	std::vector<uint8_t> degrees(localCount, CLOSED);
+	std::vector<uint8_t> entrances(localCount);
+	std::vector<int> nodeIndices(localCount, -1);
+
+	for (int y = bounds.y0; y < bounds.y1; ++y) {
+		const uint8_t* row = cells + (size_t)y * width;
+		const int localRow = (y - bounds.y0 + 1) * localWidth + 1 - bounds.x0;
+
+		for (int x = bounds.x0; x < bounds.x1; ++x) {
+			if (row[x] & Utils::CELL_WALL)
+				continue;
+
+			degrees[localRow + x] = 0;
+		}
+
+		/* Only the cells on the edges of the cluster can be entrances */
+		const bool edgeRow = y == bounds.y0 || y + 1 == bounds.y1;
+
+		for (int x = bounds.x0; x < bounds.x1; x += (edgeRow || x + 1 == bounds.x1) ? 1 : bounds.x1 - 1 - bounds.x0) {
+			if (row[x] & Utils::CELL_WALL)
+				continue;
+
+			entrances[localRow + x] = (x == bounds.x0 && x > 0 && !(row[x - 1] & Utils::CELL_WALL)) ||
+				(x + 1 == bounds.x1 && x + 1 < width && !(row[x + 1] & Utils::CELL_WALL)) ||
+				(y == bounds.y0 && y > 0 && !(row[x - width] & Utils::CELL_WALL)) ||
+				(y + 1 == bounds.y1 && y + 1 < height && !(row[x + width] & Utils::CELL_WALL));
+		}
+	}
+
+	std::vector<int> deadEnds;
+
+	for (int local = localWidth; local < localCount - localWidth; ++local) {
+		if (degrees[local] == CLOSED)
+			continue;
+
+		for (int offset : offsets)
+			degrees[local] += degrees[local + offset] != CLOSED;
+
+		if (degrees[local] <= 1 && !entrances[local])
+			deadEnds.push_back(local);
+	}
+
+	/* Dead ends are removed up to the junction they join, which may become a dead end too */
+	while (!deadEnds.empty()) {
+		int local = deadEnds.back();
+		deadEnds.pop_back();
+
+		if (degrees[local] == CLOSED)
+			continue;
+
+		degrees[local] = CLOSED;
+
+		for (int offset : offsets) {
+			int neighbor = local + offset;
+
+			if (degrees[neighbor] != CLOSED && --degrees[neighbor] <= 1 && !entrances[neighbor])
+				deadEnds.push_back(neighbor);
+		}
+	}
+
+	Cluster built;
+
+	for (int local = localWidth; local < localCount - localWidth; ++local) {
+		if (degrees[local] != CLOSED && (entrances[local] || degrees[local] != 2)) {
+			nodeIndices[local] = (int)built.nodeCells.size();
+			built.nodeCells.push_back((bounds.y0 + local / localWidth - 1) * width + bounds.x0 + local % localWidth - 1);
+		}
+	}
+
+	/* Walks the corridor leaving the node towards every open neighbor, cells between nodes have exactly two open neighbors */
+	built.edgeBegins.reserve(built.nodeCells.size() + 1);
+
+	for (int local = localWidth; local < localCount - localWidth; ++local) {
+		if (nodeIndices[local] == -1)
+			continue;
+
+		built.edgeBegins.push_back((uint32_t)built.edges.size());
+
+		for (int firstOffset : offsets) {
+			if (degrees[local + firstOffset] == CLOSED)
+				continue;
+
+			int previous = local;
+			int current = local + firstOffset;
+			int length = 1;
+
+			while (nodeIndices[current] == -1) {
+				int next = current;
+
+				for (int offset : offsets) {
+					if (degrees[current + offset] != CLOSED && current + offset != previous)
+						next = current + offset;
+				}
+
+				previous = current;
+				current = next;
+				length++;
+			}
+
+			/* A corridor looping back to its own node never shortens a path */
+			if (current != local)
+				built.edges.push_back({ (uint32_t)nodeIndices[current], length });
+		}
+	}
+
+	built.edgeBegins.push_back((uint32_t)built.edges.size());
+
+	clusters[cluster] = std::move(built);
+}
+
+/*
+PURPOSE: Searches the clusters of both cells, the nodes of the start cluster are the seeds of A* on the abstract graph
+	and the nodes of the end cluster reach the end cell with their distances inside it.
+	Every cell of the path stays in a cluster until it crosses to a neighbor cluster, so the distance is exact.
+*/
+int HierarchicalPathfinder::FindDistance(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	Rebuild();
+
+	this->startCell = startCell;
+	this->endCell = endCell;
+
+	distance = -1;
+	abstractPath.clear();
+	settledCount = 0;
+
+	if (maze.IsWall(startCell) || maze.IsWall(endCell))
+		return -1;
+
+	for (uint32_t node : reachedNodes)
+		distances[node] = INT_MAX;
+	reachedNodes.clear();
+
+	openList.clear();
+
+	const int width = maze.GetWidth();
+	const int height = maze.GetHeight();
+	const int endX = maze.GetCellX(endCell);
+	const int endY = maze.GetCellY(endCell);
+
+	const int startCluster = GetCluster(startCell);
+	const int endCluster = GetCluster(endCell);
+	const Bounds startBounds = GetBounds(startCluster);
+	const Bounds endBounds = GetBounds(endCluster);
+
+	auto GetLocal = [width](const Bounds& bounds, Utils::CellIndex cell) {
+		return (cell / width - bounds.y0) * (bounds.x1 - bounds.x0) + cell % width - bounds.x0;
+	};
+
+	auto GetHeuristic = [&](Utils::CellIndex cell) {
+		return std::abs(cell % width - endX) + std::abs(cell / width - endY);
+	};
+
+	SearchCluster(startCluster, startCell, startDistances);
+	SearchCluster(endCluster, endCell, endDistances);
+
+	/* Best distance to the end cell and the node it is reached from, INVALID_CELL means inside the shared cluster */
+	int bestDistance = INT_MAX;
+	Utils::CellIndex bestCell = Utils::INVALID_CELL;
+
+	if (startCluster == endCluster && startDistances[GetLocal(startBounds, endCell)] >= 0)
+		bestDistance = startDistances[GetLocal(startBounds, endCell)];
+
+	auto Reach = [&](uint32_t node, Utils::CellIndex cell, int newDistance, Utils::CellIndex parentCell) {
+		if (newDistance >= distances[node])
+			return;
+
+		if (distances[node] == INT_MAX)
+			reachedNodes.push_back(node);
+
+		distances[node] = newDistance;
+		parentCells[node] = parentCell;
+
+		openList.push_back({ newDistance + GetHeuristic(cell), node, cell });
+		std::push_heap(openList.begin(), openList.end(), std::greater<QueueEntry>());
+	};
+
+	const Cluster& start = clusters[startCluster];
+
+	for (size_t i = 0; i < start.nodeCells.size(); ++i) {
+		const Utils::CellIndex cell = start.nodeCells[i];
+		const int seedDistance = startDistances[GetLocal(startBounds, cell)];
+
+		if (seedDistance < 0)
+			continue;
+
+		Reach(nodeBegins[startCluster] + (uint32_t)i, cell, seedDistance, Utils::INVALID_CELL);
+	}
+
+	while (!openList.empty()) {
+		std::pop_heap(openList.begin(), openList.end(), std::greater<QueueEntry>());
+		const QueueEntry entry = openList.back();
+		openList.pop_back();
+
+		const int nodeDistance = distances[entry.node];
+
+		/* Stale entry, the node was reached again with a smaller distance */
+		if (entry.f != nodeDistance + GetHeuristic(entry.cell))
+			continue;
+
+		if (entry.f >= bestDistance)
+			break;
+
+		settledCount++;
+
+		const int cluster = GetCluster(entry.cell);
+
+		if (cluster == endCluster) {
+			const int toEnd = endDistances[GetLocal(endBounds, entry.cell)];
+
+			if (toEnd >= 0 && nodeDistance + toEnd < bestDistance) {
+				bestDistance = nodeDistance + toEnd;
+				bestCell = entry.cell;
+			}
+		}
+
+		const Cluster& current = clusters[cluster];
+		const uint32_t local = entry.node - nodeBegins[cluster];
+
+		for (uint32_t i = current.edgeBegins[local]; i < current.edgeBegins[local + 1]; ++i) {
+			const Edge& edge = current.edges[i];
+			Reach(nodeBegins[cluster] + edge.target, current.nodeCells[edge.target], nodeDistance + edge.length, entry.cell);
+		}
+
+		/* Entrances join the entrances next to them in the neighbor clusters */
+		const int x = entry.cell % width;
+		const int y = entry.cell / width;
+
+		const Utils::CellIndex neighbors[4] = {
+			y > 0 ? entry.cell - width : Utils::INVALID_CELL,
+			y + 1 < height ? entry.cell + width : Utils::INVALID_CELL,
+			x > 0 ? entry.cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? entry.cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (Utils::CellIndex neighbor : neighbors) {
+			if (neighbor == Utils::INVALID_CELL || maze.IsWall(neighbor))
+				continue;
+
+			const int neighborCluster = GetCluster(neighbor);
+			if (neighborCluster != cluster)
+				Reach((uint32_t)FindNode(neighborCluster, neighbor), neighbor, nodeDistance + 1, entry.cell);
+		}
+	}
+
+	if (bestDistance == INT_MAX)
+		return -1;
+
+	/* Built backwards from the end cell, then reversed */
+	abstractPath.push_back(endCell);
+
+	for (Utils::CellIndex cell = bestCell; cell != Utils::INVALID_CELL; cell = parentCells[FindNode(GetCluster(cell), cell)])
+		abstractPath.push_back(cell);
+
+	abstractPath.push_back(startCell);
+	std::reverse(abstractPath.begin(), abstractPath.end());
+
+	distance = bestDistance;
+	return distance;
+}
+
+/*
+PURPOSE: Consecutive cells of the abstract path in the same cluster are joined by a search inside the cluster,
+	consecutive cells in different clusters are neighbors already
+*/
+bool HierarchicalPathfinder::RefinePath(std::vector<Utils::CellIndex>& path)
+{
+	path.clear();
+
+	if (distance < 0)
+		return false;
+
+	path.push_back(abstractPath[0]);
+
+	size_t runBegin = 0;
+
+	for (size_t i = 1; i <= abstractPath.size(); ++i) {
+		const int runCluster = GetCluster(abstractPath[runBegin]);
+
+		if (i < abstractPath.size() && GetCluster(abstractPath[i]) == runCluster)
+			continue;
+
+		AppendClusterPath(runCluster, abstractPath[runBegin], abstractPath[i - 1], path);
+
+		if (i < abstractPath.size())
+			path.push_back(abstractPath[i]);
+
+		runBegin = i;
+	}
+
+	return true;
+}
+
+int HierarchicalPathfinder::GetCluster(Utils::CellIndex cell) const
+{
+	return (maze.GetCellY(cell) / clusterSize) * clustersX + maze.GetCellX(cell) / clusterSize;
+}
+
+HierarchicalPathfinder::Bounds HierarchicalPathfinder::GetBounds(int cluster) const
+{
+	Bounds bounds;
+	bounds.x0 = (cluster % clustersX) * clusterSize;
+	bounds.y0 = (cluster / clustersX) * clusterSize;
+	bounds.x1 = std::min(bounds.x0 + clusterSize, maze.GetWidth());
+	bounds.y1 = std::min(bounds.y0 + clusterSize, maze.GetHeight());
+	return bounds;
+}
+
+int HierarchicalPathfinder::FindNode(int cluster, Utils::CellIndex cell) const
+{
+	const std::vector<Utils::CellIndex>& nodeCells = clusters[cluster].nodeCells;
+	auto it = std::lower_bound(nodeCells.begin(), nodeCells.end(), cell);
+
+	if (it == nodeCells.end() || *it != cell)
+		return -1;
+
+	return (int)(nodeBegins[cluster] + (it - nodeCells.begin()));
+}
+
+void HierarchicalPathfinder::SearchCluster(int cluster, Utils::CellIndex source, std::vector<int>& distances)
+{
+	const int width = maze.GetWidth();
+	const Bounds bounds = GetBounds(cluster);
+	const int clusterWidth = bounds.x1 - bounds.x0;
+
+	distances.assign((size_t)clusterWidth * (bounds.y1 - bounds.y0), -1);
+
+	auto GetLocal = [&](Utils::CellIndex cell) {
+		return (cell / width - bounds.y0) * clusterWidth + cell % width - bounds.x0;
+	};
+
+	queue.Clear();
+	queue.Push(source);
+	distances[GetLocal(source)] = 0;
+
+	while (!queue.IsEmpty()) {
+		const Utils::CellIndex cell = queue.Pop();
+		const int x = cell % width;
+		const int y = cell / width;
+		const int nextDistance = distances[GetLocal(cell)] + 1;
+
+		const Utils::CellIndex neighbors[4] = {
+			y > bounds.y0 ? cell - width : Utils::INVALID_CELL,
+			y + 1 < bounds.y1 ? cell + width : Utils::INVALID_CELL,
+			x > bounds.x0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < bounds.x1 ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (Utils::CellIndex neighbor : neighbors) {
+			if (neighbor == Utils::INVALID_CELL || maze.IsWall(neighbor) || distances[GetLocal(neighbor)] != -1)
+				continue;
+
+			distances[GetLocal(neighbor)] = nextDistance;
+			queue.Push(neighbor);
+		}
+	}
+}
+
+/*
+PURPOSE: Searches from the cell to reach, then steps from the other cell to a neighbor one closer each time.
+	Appends the cells after <fromCell> up to <toCell>.
+*/
+void HierarchicalPathfinder::AppendClusterPath(int cluster, Utils::CellIndex fromCell, Utils::CellIndex toCell, std::vector<Utils::CellIndex>& path)
+{
+	if (fromCell == toCell)
+		return;
+
+	const int width = maze.GetWidth();
+	const Bounds bounds = GetBounds(cluster);
+	const int clusterWidth = bounds.x1 - bounds.x0;
+
+	SearchCluster(cluster, toCell, endDistances);
+
+	auto GetDistance = [&](Utils::CellIndex cell) {
+		return endDistances[(cell / width - bounds.y0) * clusterWidth + cell % width - bounds.x0];
+	};
+
+	for (Utils::CellIndex cell = fromCell; cell != toCell;) {
+		const int x = cell % width;
+		const int y = cell / width;
+		const int closerDistance = GetDistance(cell) - 1;
+
+		const Utils::CellIndex neighbors[4] = {
+			y > bounds.y0 ? cell - width : Utils::INVALID_CELL,
+			y + 1 < bounds.y1 ? cell + width : Utils::INVALID_CELL,
+			x > bounds.x0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < bounds.x1 ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (Utils::CellIndex neighbor : neighbors) {
+			if (neighbor != Utils::INVALID_CELL && GetDistance(neighbor) == closerDistance) {
+				cell = neighbor;
+				break;
+			}
+		}
+
+		path.push_back(cell);
+	}
+}
+
+void HierarchicalPathfinder::RunOnBlocks(size_t blockCount, const std::function<void(size_t)>& function)
+{
+	std::atomic<size_t> nextBlock{ 0 };
+
+	auto worker = [&]() {
+		for (size_t block = nextBlock++; block < blockCount; block = nextBlock++)
+			function(block);
+	};
+
+	size_t workerCount = (size_t)threadCount < blockCount ? (size_t)threadCount : blockCount;
+
+	std::vector<std::thread> workers;
+
+	for (size_t i = 1; i < workerCount; ++i)
+		workers.emplace_back(worker);
+
+	worker(); // The calling thread works too
+
+	for (auto& thread : workers)
+		thread.join();
+}
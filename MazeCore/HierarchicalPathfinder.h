@@ -0,0 +1,129 @@
+#pragma once
+
+/*
+
+HierarchicalPathfinder class, HPA* for very large mazes with many queries.
+The grid is split into square clusters. Open cells on the edge of a cluster with an open neighbor in the next cluster are entrances.
+Inside every cluster the dead ends which are not entrances are pruned and the remaining corridors are contracted,
+so entrances and junctions are the nodes and every corridor is an edge weighted by its length. Distances between the entrances
+of a cluster are kept exactly this way with edges linear in the entrances, a table of every entrance pair would be as big as the maze
+on perfect mazes, their clusters have entrances all along their edges.
+
+A query searches the clusters of its two cells, then runs A* on the abstract graph from the nodes of the start cluster,
+entrances of neighbor clusters are joined by edges of length 1. Distances are exact. Cells of the path are only made on request,
+one search per cluster the path passes through.
+
+Clusters are built in parallel. After walls change only the clusters of the changed cells (and the clusters sharing their edges) are rebuilt.
+
+*/
+
+#include "Utils.h"
+#include "CellQueue.h"
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+class Maze;
+
+class HierarchicalPathfinder
+{
+public:
+	HierarchicalPathfinder() = delete;
+	HierarchicalPathfinder(const Maze& maze, int clusterSize, int threadCount);
+
+	HierarchicalPathfinder(const HierarchicalPathfinder& other) = delete;
+	HierarchicalPathfinder& operator=(const HierarchicalPathfinder& other) = delete;
+
+	void Build(); // Builds every cluster
+	void MarkDirty(Utils::CellIndex cell); // Call after the wall state of the cell changed, the last path is dropped
+	void Rebuild(); // Builds the dirty clusters again, queries call it too
+
+	/* Shortest path distance between two open cells, -1 if there is no path */
+	int FindDistance(Utils::CellIndex startCell, Utils::CellIndex endCell);
+	bool RefinePath(std::vector<Utils::CellIndex>& path); // Cells of the last found path, start and end included
+
+	const std::vector<Utils::CellIndex>& GetAbstractPath() const { return abstractPath; } // Start, the nodes passed and end
+
+	int GetClusterCount() const { return (int)clusters.size(); }
+	size_t GetNodeCount() const { return nodeCount; }
+	size_t GetEdgeCount() const;
+	int GetRebuiltClusterCount() const { return rebuiltClusterCount; } // Clusters built by the last Build() or Rebuild()
+	uint64_t GetSettledCount() const { return settledCount; } // Nodes settled by the last query
+
+private:
+	struct Edge
+	{
+		uint32_t target; // Node index in the same cluster
+		int length;
+	};
+
+	/* Nodes are sorted by cell index, edges of node n are at [edgeBegins[n], edgeBegins[n + 1]) */
+	struct Cluster
+	{
+		std::vector<Utils::CellIndex> nodeCells;
+		std::vector<uint32_t> edgeBegins;
+		std::vector<Edge> edges;
+	};
+
+	struct Bounds
+	{
+		int x0, y0; // First cell
+		int x1, y1; // One past the last cell
+	};
+
+	void BuildCluster(int cluster);
+
+	int GetCluster(Utils::CellIndex cell) const;
+	Bounds GetBounds(int cluster) const;
+	int FindNode(int cluster, Utils::CellIndex cell) const; // Global node id, -1 if the cell is not a node
+
+	/* Breadth first search which never leaves the cluster, <distances> is indexed by the position in the cluster, -1 is unreached */
+	void SearchCluster(int cluster, Utils::CellIndex source, std::vector<int>& distances);
+	void AppendClusterPath(int cluster, Utils::CellIndex fromCell, Utils::CellIndex toCell, std::vector<Utils::CellIndex>& path);
+
+	/* Runs <function(block)> for every block, on the calling thread only if there is one block */
+	void RunOnBlocks(size_t blockCount, const std::function<void(size_t)>& function);
+
+private:
+	const Maze& maze;
+	int clusterSize;
+	int threadCount;
+
+	int clustersX = 0;
+	int clustersY = 0;
+
+	std::vector<Cluster> clusters;
+	std::vector<uint32_t> nodeBegins; // Global id of the first node of every cluster, cluster count + 1 entries
+	size_t nodeCount = 0;
+
+	std::vector<uint8_t> dirtyFlags;
+	std::vector<int> dirtyClusters;
+	int rebuiltClusterCount = 0;
+
+	/* Query scratch, only the reached nodes are reset */
+	struct QueueEntry
+	{
+		int f;
+		uint32_t node;
+		Utils::CellIndex cell;
+
+		bool operator>(const QueueEntry& other) const { return f > other.f; }
+	};
+
+	std::vector<int> distances;
+	std::vector<Utils::CellIndex> parentCells; // INVALID_CELL for the nodes reached from the start cell
+	std::vector<uint32_t> reachedNodes;
+	std::vector<QueueEntry> openList; // Min heap on f, the abstract graph is small and f jumps by whole corridors, so buckets would be mostly empty
+
+	std::vector<int> startDistances;
+	std::vector<int> endDistances;
+	CellQueue queue;
+
+	Utils::CellIndex startCell = Utils::INVALID_CELL;
+	Utils::CellIndex endCell = Utils::INVALID_CELL;
+	int distance = -1;
+	std::vector<Utils::CellIndex> abstractPath;
+
+	uint64_t settledCount = 0;
+};
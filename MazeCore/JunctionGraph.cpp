@@ -0,0 +1,354 @@
+#include "JunctionGraph.h"
+#include "Maze.h"
+
+
+JunctionGraph::JunctionGraph(const Maze& maze) : maze(maze)
+{
+}
+
+/*
+PURPOSE: Finds the nodes and walks every corridor leaving them.
+	Loops made only of corridor cells have no node, one of their cells becomes a node so they are covered too.
+*/
+void JunctionGraph::Build()
+{
+	const int cellCount = maze.GetCellCount();
+
+	cellOwners.assign(cellCount, NO_OWNER);
+	nodeCells.clear();
+	edgeNodes.clear();
+	edgeLengths.clear();
+	runBegins.assign(1, 0);
+	runCells.clear();
+
+	Utils::CellIndex neighbors[4];
+
+	for (Utils::CellIndex cell = 0; cell < cellCount; ++cell) {
+		if (!maze.IsWall(cell) && GetOpenNeighbors(cell, neighbors) != 2)
+			AddNode(cell);
+	}
+
+	for (int node = 0; node < GetNodeCount(); ++node)
+		WalkCorridors(node);
+
+	for (Utils::CellIndex cell = 0; cell < cellCount; ++cell) {
+		if (!maze.IsWall(cell) && cellOwners[cell] == NO_OWNER) {
+			AddNode(cell);
+			WalkCorridors(GetNodeCount() - 1);
+		}
+	}
+
+	BuildAdjacency();
+
+	/* Reached distances are never more than the longest edge ahead of the smallest one, so that many buckets are enough */
+	int longestEdge = 1;
+	for (const auto& length : edgeLengths)
+		longestEdge = length > longestEdge ? length : longestEdge;
+
+	buckets.assign(longestEdge + 1, {});
+
+	distances.assign(GetNodeCount(), INT_MAX);
+	parentEdges.assign(GetNodeCount(), -1);
+	reachedNodes.clear();
+}
+
+/*
+PURPOSE: Dijkstra on the nodes with a ring of distance buckets (Dial's algorithm). Corridor endpoints start from both nodes of their edge with the distances along the corridor,
+	and the search stops once no node can improve the best distance to the end cell.
+*/
+bool JunctionGraph::Solve(Utils::CellIndex startCell, Utils::CellIndex endCell, std::vector<Utils::CellIndex>& path)
+{
+	path.clear();
+	settledCount = 0;
+
+	if (maze.IsWall(startCell) || maze.IsWall(endCell))
+		return false;
+
+	if (startCell == endCell) {
+		path.push_back(startCell);
+		return true;
+	}
+
+	for (const auto& node : reachedNodes) {
+		distances[node] = INT_MAX;
+		parentEdges[node] = -1;
+	}
+	reachedNodes.clear();
+
+	const Location start = Locate(startCell);
+	const Location end = Locate(endCell);
+
+	for (auto& bucket : buckets)
+		bucket.clear();
+
+	const int bucketCount = (int)buckets.size();
+	size_t queuedCount = 0;
+
+	auto Reach = [&](int node, int distance, int parentEdge) {
+		if (distance >= distances[node])
+			return;
+
+		if (distances[node] == INT_MAX)
+			reachedNodes.push_back(node);
+
+		distances[node] = distance;
+		parentEdges[node] = parentEdge;
+
+		buckets[distance % bucketCount].push_back(node);
+		queuedCount++;
+	};
+
+	if (start.edge == -1) {
+		Reach(start.node, 0, -1);
+	}
+	else {
+		Reach(edgeNodes[2 * start.edge], start.runIndex + 1, -1);
+		Reach(edgeNodes[2 * start.edge + 1], edgeLengths[start.edge] - start.runIndex - 1, -1);
+	}
+
+	/* Best distance to the end cell and the node it is reached from, -1 means along the shared corridor */
+	int bestDistance = INT_MAX;
+	int bestNode = -1;
+
+	if (start.edge != -1 && start.edge == end.edge)
+		bestDistance = std::abs(start.runIndex - end.runIndex);
+
+	/* Seeds are at most one edge long, so the smallest of them is where the buckets start */
+	int distance = start.edge == -1 ? 0 : std::min(start.runIndex + 1, edgeLengths[start.edge] - start.runIndex - 1);
+
+	while (queuedCount > 0) {
+		std::vector<int>& bucket = buckets[distance % bucketCount];
+
+		if (bucket.empty()) {
+			distance++;
+			continue;
+		}
+
+		int node = bucket.back();
+		bucket.pop_back();
+		queuedCount--;
+
+		/* Stale entry, the node was reached again with a smaller distance */
+		if (distance != distances[node])
+			continue;
+
+		if (distance >= bestDistance)
+			break;
+
+		settledCount++;
+
+		if (end.edge == -1) {
+			if (node == end.node) {
+				bestDistance = distance;
+				bestNode = node;
+				break;
+			}
+		}
+		else {
+			/* A node of the end corridor reaches the end cell along the corridor */
+			int toEnd = INT_MAX;
+
+			if (node == edgeNodes[2 * end.edge])
+				toEnd = end.runIndex + 1;
+			if (node == edgeNodes[2 * end.edge + 1] && edgeLengths[end.edge] - end.runIndex - 1 < toEnd)
+				toEnd = edgeLengths[end.edge] - end.runIndex - 1;
+
+			if (toEnd != INT_MAX && distance + toEnd < bestDistance) {
+				bestDistance = distance + toEnd;
+				bestNode = node;
+			}
+		}
+
+		for (int i = adjacencyBegins[node]; i < adjacencyBegins[node + 1]; ++i)
+			Reach(adjacencyNodes[i], distance + edgeLengths[adjacencyEdges[i]], adjacencyEdges[i]);
+	}
+
+	if (bestDistance == INT_MAX)
+		return false;
+
+	/* Built backwards from the end cell, then reversed */
+	if (bestNode == -1) {
+		AppendRun(start.edge, end.runIndex, start.runIndex, path);
+	}
+	else {
+		if (end.edge != -1) {
+			bool fromFirstNode = bestNode == edgeNodes[2 * end.edge] && end.runIndex + 1 + distances[bestNode] == bestDistance;
+			AppendRun(end.edge, end.runIndex, fromFirstNode ? 0 : edgeLengths[end.edge] - 2, path);
+		}
+
+		int node = bestNode;
+		path.push_back(nodeCells[node]);
+
+		while (parentEdges[node] != -1) {
+			int edge = parentEdges[node];
+			bool enteredForward = edgeNodes[2 * edge + 1] == node; // Run order is the direction it was walked in
+
+			int parentNode = enteredForward ? edgeNodes[2 * edge] : edgeNodes[2 * edge + 1];
+			int runLength = edgeLengths[edge] - 1;
+
+			if (runLength > 0) {
+				if (enteredForward)
+					AppendRun(edge, runLength - 1, 0, path);
+				else
+					AppendRun(edge, 0, runLength - 1, path);
+			}
+
+			node = parentNode;
+			path.push_back(nodeCells[node]);
+		}
+
+		if (start.edge != -1) {
+			bool toFirstNode = node == edgeNodes[2 * start.edge] && start.runIndex + 1 == distances[node];
+			AppendRun(start.edge, toFirstNode ? 0 : edgeLengths[start.edge] - 2, start.runIndex, path);
+		}
+	}
+
+	std::reverse(path.begin(), path.end());
+	return true;
+}
+
+void JunctionGraph::AddNode(Utils::CellIndex cell)
+{
+	cellOwners[cell] = GetNodeCount();
+	nodeCells.push_back(cell);
+}
+
+/*
+PURPOSE: Follows each open direction of the node through corridor cells until another node, corridor cells are owned by the edge they are on
+*/
+void JunctionGraph::WalkCorridors(int node)
+{
+	Utils::CellIndex neighbors[4];
+	Utils::CellIndex corridorNeighbors[4];
+
+	const int neighborCount = GetOpenNeighbors(nodeCells[node], neighbors);
+
+	for (int i = 0; i < neighborCount; ++i) {
+		Utils::CellIndex previousCell = nodeCells[node];
+		Utils::CellIndex cell = neighbors[i];
+
+		/* Two neighbor nodes, the edge is created once from the smaller node */
+		if (cellOwners[cell] >= 0) {
+			if (node < cellOwners[cell]) {
+				edgeNodes.push_back(node);
+				edgeNodes.push_back(cellOwners[cell]);
+				edgeLengths.push_back(1);
+				runBegins.push_back((int)runCells.size());
+			}
+			continue;
+		}
+
+		/* Corridor walked already from its other end */
+		if (cellOwners[cell] != NO_OWNER)
+			continue;
+
+		const int edge = GetEdgeCount();
+
+		while (cellOwners[cell] == NO_OWNER) {
+			cellOwners[cell] = -2 - edge;
+			runCells.push_back(cell);
+
+			GetOpenNeighbors(cell, corridorNeighbors);
+			Utils::CellIndex nextCell = corridorNeighbors[0] == previousCell ? corridorNeighbors[1] : corridorNeighbors[0];
+
+			previousCell = cell;
+			cell = nextCell;
+		}
+
+		edgeNodes.push_back(node);
+		edgeNodes.push_back(cellOwners[cell]);
+		edgeLengths.push_back((int)runCells.size() - runBegins.back() + 1);
+		runBegins.push_back((int)runCells.size());
+	}
+}
+
+void JunctionGraph::BuildAdjacency()
+{
+	const int nodeCount = GetNodeCount();
+	const int edgeCount = GetEdgeCount();
+
+	adjacencyBegins.assign(nodeCount + 1, 0);
+
+	/* Self loops never shorten a path, they are left out */
+	for (int edge = 0; edge < edgeCount; ++edge) {
+		if (edgeNodes[2 * edge] == edgeNodes[2 * edge + 1])
+			continue;
+
+		adjacencyBegins[edgeNodes[2 * edge] + 1]++;
+		adjacencyBegins[edgeNodes[2 * edge + 1] + 1]++;
+	}
+
+	for (int node = 0; node < nodeCount; ++node)
+		adjacencyBegins[node + 1] += adjacencyBegins[node];
+
+	adjacencyNodes.resize(adjacencyBegins[nodeCount]);
+	adjacencyEdges.resize(adjacencyBegins[nodeCount]);
+
+	std::vector<int> fill(adjacencyBegins.begin(), adjacencyBegins.end() - 1);
+
+	for (int edge = 0; edge < edgeCount; ++edge) {
+		int node0 = edgeNodes[2 * edge];
+		int node1 = edgeNodes[2 * edge + 1];
+
+		if (node0 == node1)
+			continue;
+
+		adjacencyNodes[fill[node0]] = node1;
+		adjacencyEdges[fill[node0]++] = edge;
+
+		adjacencyNodes[fill[node1]] = node0;
+		adjacencyEdges[fill[node1]++] = edge;
+	}
+}
+
+JunctionGraph::Location JunctionGraph::Locate(Utils::CellIndex cell) const
+{
+	Location location;
+
+	if (cellOwners[cell] >= 0) {
+		location.node = cellOwners[cell];
+		return location;
+	}
+
+	location.edge = -2 - cellOwners[cell];
+
+	for (int i = runBegins[location.edge]; i < runBegins[location.edge + 1]; ++i) {
+		if (runCells[i] == cell) {
+			location.runIndex = i - runBegins[location.edge];
+			break;
+		}
+	}
+
+	return location;
+}
+
+void JunctionGraph::AppendRun(int edge, int fromIndex, int toIndex, std::vector<Utils::CellIndex>& cells) const
+{
+	const Utils::CellIndex* run = runCells.data() + runBegins[edge];
+
+	if (fromIndex <= toIndex) {
+		for (int i = fromIndex; i <= toIndex; ++i)
+			cells.push_back(run[i]);
+	}
+	else {
+		for (int i = fromIndex; i >= toIndex; --i)
+			cells.push_back(run[i]);
+	}
+}
+
+int JunctionGraph::GetOpenNeighbors(Utils::CellIndex cell, Utils::CellIndex neighbors[4]) const
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+	const int x = cell % width;
+
+	int neighborCount = 0;
+
+	/* Same order as Utils::GetDirection */
+	if (cell >= width && !maze.IsWall(cell - width)) neighbors[neighborCount++] = cell - width;
+	if (cell + width < cellCount && !maze.IsWall(cell + width)) neighbors[neighborCount++] = cell + width;
+	if (x > 0 && !maze.IsWall(cell - 1)) neighbors[neighborCount++] = cell - 1;
+	if (x + 1 < width && !maze.IsWall(cell + 1)) neighbors[neighborCount++] = cell + 1;
+
+	return neighborCount;
+}
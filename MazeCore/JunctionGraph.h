@@ -0,0 +1,86 @@
+#pragma once
+
+/*
+
+JunctionGraph class that contracts the corridors of a maze into weighted edges for fast repeated solving.
+Junctions and dead ends (open cells without exactly two open neighbors) are the nodes, every corridor between two of them is an edge
+weighted by its length. The adjacency is stored in compressed sparse row form and every edge keeps the run of corridor cells
+between its nodes, so a path on the graph expands back into cells.
+
+The graph is built once from the current walls and answers any number of queries, the endpoints may be corridor cells too.
+It has to be built again after walls change.
+
+*/
+
+#include "Utils.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class JunctionGraph
+{
+public:
+	JunctionGraph() = delete;
+	JunctionGraph(const Maze& maze);
+
+	JunctionGraph(const JunctionGraph& other) = delete;
+	JunctionGraph& operator=(const JunctionGraph& other) = delete;
+
+	void Build();
+
+	/* Shortest path between two open cells, <path> gets the cells from start to end, both included */
+	bool Solve(Utils::CellIndex startCell, Utils::CellIndex endCell, std::vector<Utils::CellIndex>& path);
+
+	int GetNodeCount() const { return (int)nodeCells.size(); }
+	int GetEdgeCount() const { return (int)edgeLengths.size(); }
+
+	uint64_t GetSettledCount() const { return settledCount; } // Nodes settled by the last query
+
+private:
+	/* Where a cell is on the graph, <edge> is -1 for nodes */
+	struct Location
+	{
+		int node = -1;
+		int edge = -1;
+		int runIndex = 0; // Position in the run of the edge
+	};
+
+	void AddNode(Utils::CellIndex cell);
+	void WalkCorridors(int node); // Creates the edges leaving the node which are not created yet
+	void BuildAdjacency();
+
+	Location Locate(Utils::CellIndex cell) const;
+	void AppendRun(int edge, int fromIndex, int toIndex, std::vector<Utils::CellIndex>& cells) const; // Both included, any order
+	int GetOpenNeighbors(Utils::CellIndex cell, Utils::CellIndex neighbors[4]) const;
+
+private:
+	static constexpr int NO_OWNER = -1;
+
+	const Maze& maze;
+
+	/* Node id for nodes, -2 - <edge> for corridor cells */
+	std::vector<int> cellOwners;
+
+	std::vector<Utils::CellIndex> nodeCells;
+
+	/* Edges, the run holds the corridor cells from the first node to the second one */
+	std::vector<int> edgeNodes; // Two nodes per edge
+	std::vector<int> edgeLengths;
+	std::vector<int> runBegins; // Edge count + 1 offsets into runCells
+	std::vector<Utils::CellIndex> runCells;
+
+	/* CSR adjacency, neighbors of node n are at [adjacencyBegins[n], adjacencyBegins[n + 1]) */
+	std::vector<int> adjacencyBegins;
+	std::vector<int> adjacencyNodes;
+	std::vector<int> adjacencyEdges;
+
+	/* Query scratch, only the reached nodes are reset */
+	std::vector<int> distances;
+	std::vector<int> parentEdges;
+	std::vector<int> reachedNodes;
+	std::vector<std::vector<int>> buckets; // Distance % bucket count
+
+	uint64_t settledCount = 0;
+};
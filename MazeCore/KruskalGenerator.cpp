@@ -0,0 +1,206 @@
+#include "KruskalGenerator.h"
+#include "Maze.h"
+
+#include <thread>
+#include <atomic>
+
+KruskalGenerator::KruskalGenerator(Maze& maze, int threadCount) : maze(maze), threadCount(threadCount)
+{
+	if (this->threadCount < 1)
+		this->threadCount = 1;
+
+	latticeWidth = (maze.GetWidth() - 1) / 2;
+	latticeHeight = (maze.GetHeight() - 1) / 2;
+}
+
+void KruskalGenerator::Start(Random& random)
+{
+	const int latticeCount = latticeWidth * latticeHeight;
+
+	parent.assign(latticeCount, -1);
+
+	walls.clear();
+	walls.reserve((size_t)latticeCount * 2);
+
+	/* Every lattice cell is open and is its own set */
+	for (int latticeIndex = 0; latticeIndex < latticeCount; ++latticeIndex) {
+		maze.SetWall(GetLatticeCell(latticeIndex), false);
+
+		int latticeX = latticeIndex % latticeWidth;
+		int latticeY = latticeIndex / latticeWidth;
+
+		if (latticeX + 1 < latticeWidth)
+			walls.push_back((uint32_t)latticeIndex * 2);
+		if (latticeY + 1 < latticeHeight)
+			walls.push_back((uint32_t)latticeIndex * 2 + 1);
+	}
+
+	ShuffleWalls(random);
+
+	nextWall = 0;
+	remainingJoins = latticeCount > 0 ? latticeCount - 1 : 0;
+	headCell = Utils::INVALID_CELL;
+}
+
+/*
+PURPOSE: Removes the next wall which joins two different sets, walls inside a set are skipped in the same step.
+	The walls were shuffled by Start(), so steps don't use the random stream.
+*/
+bool KruskalGenerator::Step(Random& /* random */)
+{
+	while (remainingJoins > 0 && nextWall < walls.size()) {
+		uint32_t wall = walls[nextWall++];
+
+		int latticeIndex = (int)(wall >> 1);
+		bool isDownWall = (wall & 1) != 0;
+		int neighborIndex = isDownWall ? latticeIndex + latticeWidth : latticeIndex + 1;
+
+		if (!UnionSets(latticeIndex, neighborIndex))
+			continue;
+
+		headCell = GetLatticeCell(latticeIndex) + (isDownWall ? maze.GetWidth() : 1);
+		maze.SetWall(headCell, false);
+
+		remainingJoins--;
+		return true;
+	}
+
+	headCell = Utils::INVALID_CELL;
+	return false;
+}
+
+/*
+PURPOSE: Shuffles the wall list uniformly on <threadCount> threads.
+	Each block scatters its walls into random buckets, then every bucket is shuffled on its own.
+	A random bucket per element followed by a uniform shuffle of each bucket gives a uniform permutation of the whole list.
+	The block count only depends on the list size, so thread count doesn't change the result.
+*/
+void KruskalGenerator::ShuffleWalls(Random& random)
+{
+	const size_t wallCount = walls.size();
+
+	size_t blockCount = wallCount / MIN_SHUFFLE_BLOCK_SIZE;
+	if (blockCount < 1)
+		blockCount = 1;
+	if (blockCount > MAX_SHUFFLE_BLOCKS)
+		blockCount = MAX_SHUFFLE_BLOCKS;
+
+	/* Streams are derived in block order before any thread starts, so they don't depend on scheduling */
+	std::vector<Random> blockRandoms;
+	blockRandoms.reserve(blockCount);
+
+	for (size_t i = 0; i < blockCount; ++i)
+		blockRandoms.push_back(random.Split());
+
+	auto GetBlockBegin = [&](size_t block) { return wallCount * block / blockCount; };
+
+	std::vector<uint8_t> buckets(wallCount);
+	std::vector<size_t> bucketCounts(blockCount * blockCount, 0); // [block][bucket]
+
+	auto RunOnBlocks = [&](auto&& function) {
+		std::atomic<size_t> nextBlock{ 0 };
+
+		auto worker = [&]() {
+			for (size_t block = nextBlock++; block < blockCount; block = nextBlock++)
+				function(block);
+		};
+
+		size_t workerCount = (size_t)threadCount < blockCount ? (size_t)threadCount : blockCount;
+
+		std::vector<std::thread> workers;
+
+		for (size_t i = 1; i < workerCount; ++i)
+			workers.emplace_back(worker);
+
+		worker(); // The calling thread works too
+
+		for (auto& thread : workers)
+			thread.join();
+	};
+
+	/* Pick a bucket for every wall */
+	RunOnBlocks([&](size_t block) {
+		size_t* counts = &bucketCounts[block * blockCount];
+
+		for (size_t i = GetBlockBegin(block); i < GetBlockBegin(block + 1); ++i) {
+			buckets[i] = (uint8_t)blockRandoms[block].NextInt((int)blockCount);
+			counts[buckets[i]]++;
+		}
+	});
+
+	/* Bucket b of block k starts after all smaller buckets and after bucket b of the previous blocks */
+	std::vector<size_t> bucketOffsets(blockCount * blockCount);
+	std::vector<size_t> bucketBegins(blockCount + 1);
+	size_t offset = 0;
+
+	for (size_t bucket = 0; bucket < blockCount; ++bucket) {
+		bucketBegins[bucket] = offset;
+
+		for (size_t block = 0; block < blockCount; ++block) {
+			bucketOffsets[block * blockCount + bucket] = offset;
+			offset += bucketCounts[block * blockCount + bucket];
+		}
+	}
+	bucketBegins[blockCount] = offset;
+
+	std::vector<uint32_t> scattered(wallCount);
+
+	RunOnBlocks([&](size_t block) {
+		size_t* offsets = &bucketOffsets[block * blockCount];
+
+		for (size_t i = GetBlockBegin(block); i < GetBlockBegin(block + 1); ++i)
+			scattered[offsets[buckets[i]]++] = walls[i];
+	});
+
+	/* Fisher-Yates on every bucket, bucket i uses the stream of block i */
+	RunOnBlocks([&](size_t bucket) {
+		Random& bucketRandom = blockRandoms[bucket];
+		uint32_t* bucketWalls = scattered.data() + bucketBegins[bucket];
+		size_t bucketSize = bucketBegins[bucket + 1] - bucketBegins[bucket];
+
+		for (size_t i = bucketSize; i > 1; --i)
+			std::swap(bucketWalls[i - 1], bucketWalls[bucketRandom.NextInt((int)i)]);
+	});
+
+	walls.swap(scattered);
+}
+
+int KruskalGenerator::FindSet(int latticeIndex)
+{
+	/* Path halving, every other cell of the path is pointed to its grandparent and the walk continues from there */
+	while (parent[latticeIndex] >= 0) {
+		int next = parent[latticeIndex];
+
+		if (parent[next] < 0)
+			return next; // Parent is the root, negative parents hold the rank
+
+		parent[latticeIndex] = parent[next];
+		latticeIndex = parent[latticeIndex];
+	}
+	return latticeIndex;
+}
+
+bool KruskalGenerator::UnionSets(int latticeIndex0, int latticeIndex1)
+{
+	int root0 = FindSet(latticeIndex0);
+	int root1 = FindSet(latticeIndex1);
+
+	if (root0 == root1)
+		return false;
+
+	/* Union by rank, roots hold -1 - rank so both live in one array */
+	if (parent[root0] > parent[root1])
+		std::swap(root0, root1);
+
+	if (parent[root0] == parent[root1])
+		parent[root0]--;
+
+	parent[root1] = root0;
+
+	return true;
+}
+
+Utils::CellIndex KruskalGenerator::GetLatticeCell(int latticeIndex) const
+{
+	return maze.GetCellFromXY(2 * (latticeIndex % latticeWidth) + 1, 2 * (latticeIndex / latticeWidth) + 1);
+}
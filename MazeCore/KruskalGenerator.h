@@ -0,0 +1,66 @@
+#pragma once
+
+/*
+
+KruskalGenerator class that generates a perfect maze with randomized Kruskal's algorithm.
+All lattice cells start as separate sets, walls between them are visited in a random order
+and removed when they join two different sets.
+
+Sets are kept in a flat union-find with path halving and union by rank.
+The wall list is shuffled in parallel in blocks, each block has its own random stream,
+so the maze is the same for a given seed whatever the thread count is.
+
+*/
+
+#include "StepGenerator.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class KruskalGenerator : public StepGenerator
+{
+public:
+	KruskalGenerator() = delete;
+	KruskalGenerator(Maze& maze, int threadCount);
+
+	KruskalGenerator(const KruskalGenerator& other) = delete;
+	KruskalGenerator& operator=(const KruskalGenerator& other) = delete;
+
+	void Start(Random& random) override;
+	bool Step(Random& random) override;
+
+	Utils::CellIndex GetHeadCell() const override { return headCell; }
+
+private:
+	void ShuffleWalls(Random& random);
+
+	/* Union-find over lattice indices */
+	int FindSet(int latticeIndex);
+	bool UnionSets(int latticeIndex0, int latticeIndex1); // Returns false if they are already in the same set
+
+	/* Helpers */
+	Utils::CellIndex GetLatticeCell(int latticeIndex) const;
+
+private:
+	static constexpr int MAX_SHUFFLE_BLOCKS = 64;
+	static constexpr int MIN_SHUFFLE_BLOCK_SIZE = 1 << 14;
+
+	Maze& maze;
+
+	int threadCount;
+
+	int latticeWidth;  // Odd cells on a row
+	int latticeHeight; // Odd cells on a column
+
+	/* Walls are stored as <lattice index> * 2 + <0 for the right wall, 1 for the wall below> */
+	std::vector<uint32_t> walls;
+	size_t nextWall = 0;
+
+	std::vector<int> parent; // Parent index, or -1 - rank for the roots
+
+	int remainingJoins = 0; // A spanning tree is complete after <lattice cell count> - 1 joins
+
+	Utils::CellIndex headCell = Utils::INVALID_CELL;
+};
@@ -0,0 +1,224 @@
+#include "LpaStarSolver.h"
+#include "Maze.h"
+
+#include <algorithm>
+#include <functional>
+
+LpaStarSolver::LpaStarSolver(const Maze& maze) : maze(maze)
+{
+}
+
+bool LpaStarSolver::Solve(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	this->startCell = startCell;
+	this->endCell = endCell;
+
+	endX = maze.GetCellX(endCell);
+	endY = maze.GetCellY(endCell);
+
+	g.assign(maze.GetCellCount(), INFINITE_DISTANCE);
+	rhs.assign(maze.GetCellCount(), INFINITE_DISTANCE);
+
+	queue.clear();
+	compactedQueueSize = 0;
+	expandedCount = 0;
+
+	rhs[startCell] = 0;
+	queue.push_back({ CalculateKey(startCell), startCell });
+
+	repairing = false;
+	ComputeShortestPath(UINT64_MAX);
+	BuildPath();
+	return pathFound;
+}
+
+/*
+PURPOSE: The toggled cell and its neighbors get their rhs again from their neighbors, the repair starts from the ones which became inconsistent.
+	Cells can be toggled in the middle of an unfinished repair too.
+*/
+void LpaStarSolver::UpdateCell(Utils::CellIndex cell)
+{
+	if (!repairing)
+		expandedCount = 0;
+
+	UpdateVertex(cell);
+	UpdateNeighbors(cell);
+
+	repairing = true;
+	pathFound = false;
+	path.clear();
+}
+
+bool LpaStarSolver::Repair(uint64_t maxExpansions)
+{
+	if (!repairing)
+		return true;
+
+	if (!ComputeShortestPath(maxExpansions))
+		return false;
+
+	repairing = false;
+	BuildPath();
+
+	if (queue.size() > 2 * compactedQueueSize + 4096)
+		CompactQueue();
+
+	return true;
+}
+
+uint64_t LpaStarSolver::CalculateKey(Utils::CellIndex cell) const
+{
+	int distance = std::min(g[cell], rhs[cell]);
+	int heuristic = std::abs(maze.GetCellX(cell) - endX) + std::abs(maze.GetCellY(cell) - endY);
+
+	/* Both parts fit in 32 bits, so comparing the packed key compares the first part and then the second */
+	return ((uint64_t)(distance + heuristic) << 32) | (uint64_t)distance;
+}
+
+void LpaStarSolver::UpdateVertex(Utils::CellIndex cell)
+{
+	if (cell != startCell) {
+		int best = INFINITE_DISTANCE;
+
+		if (!maze.IsWall(cell)) {
+			const int width = maze.GetWidth();
+			const int cellCount = maze.GetCellCount();
+			const int x = cell % width;
+
+			if (cell >= width && !maze.IsWall(cell - width)) best = std::min(best, g[cell - width] + 1);
+			if (cell + width < cellCount && !maze.IsWall(cell + width)) best = std::min(best, g[cell + width] + 1);
+			if (x > 0 && !maze.IsWall(cell - 1)) best = std::min(best, g[cell - 1] + 1);
+			if (x + 1 < width && !maze.IsWall(cell + 1)) best = std::min(best, g[cell + 1] + 1);
+		}
+
+		rhs[cell] = std::min(best, INFINITE_DISTANCE);
+	}
+
+	if (g[cell] != rhs[cell]) {
+		queue.push_back({ CalculateKey(cell), cell });
+		std::push_heap(queue.begin(), queue.end(), std::greater<Entry>());
+	}
+}
+
+void LpaStarSolver::UpdateNeighbors(Utils::CellIndex cell)
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+	const int x = cell % width;
+
+	if (cell >= width) UpdateVertex(cell - width);
+	if (cell + width < cellCount) UpdateVertex(cell + width);
+	if (x > 0) UpdateVertex(cell - 1);
+	if (x + 1 < width) UpdateVertex(cell + 1);
+}
+
+/*
+PURPOSE: Processes inconsistent cells in key order until the end cell is consistent and no cell with a smaller key is left.
+	Overconsistent cells (g > rhs) take their new distance, underconsistent ones forget theirs and are pushed again with rhs.
+	Stops after maxExpansions cells, the queue keeps the rest of the work.
+*/
+bool LpaStarSolver::ComputeShortestPath(uint64_t maxExpansions)
+{
+	uint64_t expansions = 0;
+
+	while (!queue.empty()) {
+		const Entry top = queue.front();
+
+		if (top.key >= CalculateKey(endCell) && g[endCell] == rhs[endCell])
+			break;
+
+		std::pop_heap(queue.begin(), queue.end(), std::greater<Entry>());
+		queue.pop_back();
+
+		Utils::CellIndex cell = top.cell;
+
+		/* Outdated entry, the cell became consistent or was pushed again with another key */
+		if (g[cell] == rhs[cell] || top.key != CalculateKey(cell))
+			continue;
+
+		/* Out of budget, the entry goes back and the next call continues from it */
+		if (expansions == maxExpansions) {
+			queue.push_back(top);
+			std::push_heap(queue.begin(), queue.end(), std::greater<Entry>());
+			return false;
+		}
+
+		expansions++;
+		expandedCount++;
+
+		if (g[cell] > rhs[cell]) {
+			g[cell] = rhs[cell];
+		}
+		else {
+			g[cell] = INFINITE_DISTANCE;
+			UpdateVertex(cell);
+		}
+
+		UpdateNeighbors(cell);
+	}
+
+	return true;
+}
+
+/*
+PURPOSE: Drops outdated entries, the remaining inconsistent cells are needed by later repairs
+*/
+void LpaStarSolver::CompactQueue()
+{
+	std::erase_if(queue, [this](const Entry& entry) {
+		return g[entry.cell] == rhs[entry.cell] || entry.key != CalculateKey(entry.cell);
+	});
+
+	std::make_heap(queue.begin(), queue.end(), std::greater<Entry>());
+	compactedQueueSize = queue.size();
+}
+
+/*
+PURPOSE: Walks from the end cell to a neighbor one step closer to the start cell until the start cell, then reverses the cells
+*/
+void LpaStarSolver::BuildPath()
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+
+	path.clear();
+	pathFound = false;
+
+	if (g[endCell] >= INFINITE_DISTANCE)
+		return;
+
+	Utils::CellIndex cell = endCell;
+	path.push_back(cell);
+
+	while (cell != startCell) {
+		const int x = cell % width;
+
+		/* Same order as Utils::GetDirection */
+		const Utils::CellIndex neighbors[4] = {
+			cell >= width ? cell - width : Utils::INVALID_CELL,
+			cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+			x > 0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		Utils::CellIndex closer = Utils::INVALID_CELL;
+
+		for (Utils::CellIndex neighbor : neighbors) {
+			if (neighbor != Utils::INVALID_CELL && !maze.IsWall(neighbor) && g[neighbor] == g[cell] - 1) {
+				closer = neighbor;
+				break;
+			}
+		}
+
+		if (closer == Utils::INVALID_CELL) {
+			path.clear();
+			return;
+		}
+
+		cell = closer;
+		path.push_back(cell);
+	}
+
+	std::reverse(path.begin(), path.end());
+	pathFound = true;
+}
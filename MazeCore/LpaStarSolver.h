@@ -0,0 +1,82 @@
+#pragma once
+
+/*
+
+LpaStarSolver class, Lifelong Planning A* for mazes whose walls change after they are solved.
+Every cell keeps g, its distance found so far, and rhs, the distance its open neighbors imply (one more than their smallest g).
+Cells where the two differ are inconsistent and wait in a priority queue ordered by [min(g, rhs) + h, min(g, rhs)],
+h is the Manhattan distance to the end cell. The first search works like A*, after a wall is toggled only the toggled cell and its neighbors
+become inconsistent, and the repair processes just the cells whose distances change and are not farther than the end cell.
+A repair can be split over frames with an expansion budget, closing a path cell of a perfect maze cuts a whole region off
+and every cell of it has to forget its distance, which takes longer than a frame on big mazes.
+
+The queue is a binary heap without decrease key, a cell is pushed again when its key changes and outdated entries are skipped,
+it is compacted when outdated entries pile up.
+
+*/
+
+#include "Utils.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class LpaStarSolver
+{
+public:
+	LpaStarSolver() = delete;
+	LpaStarSolver(const Maze& maze);
+
+	LpaStarSolver(const LpaStarSolver& other) = delete;
+	LpaStarSolver& operator=(const LpaStarSolver& other) = delete;
+
+	bool Solve(Utils::CellIndex startCell, Utils::CellIndex endCell); // Full search, returns true if a path is found
+	void UpdateCell(Utils::CellIndex cell); // Call after the wall state of the cell changed, Repair() brings the path up to date
+	bool Repair(uint64_t maxExpansions = UINT64_MAX); // Returns true when the repair is finished, otherwise call it again
+
+	bool IsRepairing() const { return repairing; }
+	bool IsPathFound() const { return pathFound; }
+	const std::vector<Utils::CellIndex>& GetPath() const { return path; } // From the start cell to the end cell, both included
+
+	uint64_t GetExpandedCount() const { return expandedCount; } // Cells processed by the last search or the repair since the last edit
+
+private:
+	struct Entry
+	{
+		uint64_t key;
+		Utils::CellIndex cell;
+
+		bool operator>(const Entry& other) const { return key > other.key; }
+	};
+
+	uint64_t CalculateKey(Utils::CellIndex cell) const;
+	void UpdateVertex(Utils::CellIndex cell);
+	void UpdateNeighbors(Utils::CellIndex cell);
+	bool ComputeShortestPath(uint64_t maxExpansions); // Returns false when the budget runs out
+	void CompactQueue();
+
+	void BuildPath();
+
+private:
+	static constexpr int INFINITE_DISTANCE = INT32_MAX / 2;
+
+	const Maze& maze;
+
+	std::vector<int> g;
+	std::vector<int> rhs;
+
+	std::vector<Entry> queue; // Min heap on key
+	size_t compactedQueueSize = 0;
+
+	Utils::CellIndex startCell = Utils::INVALID_CELL;
+	Utils::CellIndex endCell = Utils::INVALID_CELL;
+	int endX = 0;
+	int endY = 0;
+
+	bool repairing = false;
+	bool pathFound = false;
+	std::vector<Utils::CellIndex> path;
+
+	uint64_t expandedCount = 0;
+};
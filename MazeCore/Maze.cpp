@@ -0,0 +1,1054 @@
+#include "Maze.h"
+#include "TiledGenerator.h"
+#include "EllerGenerator.h"
+#include "KruskalGenerator.h"
+#include "WilsonGenerator.h"
+#include "GrowingTreeGenerator.h"
+#include "BreadthFirstSolver.h"
+#include "AStarSolver.h"
+#include "BidirectionalSolver.h"
+#include "ParallelBreadthFirstSolver.h"
+#include "BitboardSolver.h"
+#include "DeadEndSolver.h"
+#include "DijkstraSolver.h"
+
+#include <thread>
+
+void Maze::GenerateMaze()
+{
+	/* Initialize parameters, a maze may be generated again with another seed */
+	ResetGrid();
+	generating = true;
+
+	SeedRandom();
+
+	if (generationAlgorithm != Utils::GenerationAlgorithm::Backtracker) {
+		int threadCount = generationThreadCount > 0 ? generationThreadCount : (int)std::thread::hardware_concurrency();
+
+		switch (generationAlgorithm)
+		{
+		case Utils::GenerationAlgorithm::Kruskal:
+			stepGenerator = std::make_unique<KruskalGenerator>(*this, threadCount);
+			std::cout << "Kruskal Maze Generation Started\n";
+			break;
+		case Utils::GenerationAlgorithm::Wilson:
+			stepGenerator = std::make_unique<WilsonGenerator>(*this, aldousBroderFraction);
+			std::cout << "Wilson Maze Generation Started\n";
+			break;
+		case Utils::GenerationAlgorithm::GrowingTree:
+			stepGenerator = std::make_unique<GrowingTreeGenerator>(*this, growingTreePolicy, growingTreeNewestWeight);
+			std::cout << "Growing Tree Maze Generation Started\n";
+			break;
+		default:
+			break;
+		}
+
+		stepGenerator->Start(random);
+		return;
+	}
+
+	do {
+		/* Separate statements, argument evaluation order differs between compilers */
+		int startX = random.NextInt(width);
+		int startY = random.NextInt(height);
+
+		startCell = GetCellFromXY(startX, startY);
+
+	} while (GetCellX(startCell) % 2 == 0 || GetCellY(startCell) % 2 == 0); // Ensure start cell is odd indexed
+
+	//GenerateStep(startCell); // This is recursive and may block the main thread
+	// Instead, we will implement iterative generation in UpdateGeneration
+	// by pushing the start cell onto the stack
+
+	SetWall(startCell, false); // Mark start cell as part of the maze
+	generationStack.push_back(startCell);
+
+	std::cout << "Maze Generation Started from (" << GetCellX(startCell) << ", " << GetCellY(startCell) << ")\n";
+}
+
+/*
+PURPOSE: Generates the whole maze at once on <threadCount> threads, see TiledGenerator.
+	It is not stepped, so generation is already complete when this function returns.
+*/
+void Maze::GenerateMazeTiled(int tileSize, int threadCount)
+{
+	ResetGrid();
+	generating = true;
+
+	SeedRandom();
+
+	threadCount = threadCount > 0 ? threadCount : (int)std::thread::hardware_concurrency();
+
+	std::cout << "Tiled Maze Generation Started with " << threadCount << " threads and " << tileSize << " cell tiles\n";
+
+	TiledGenerator generator(*this, tileSize, threadCount);
+	generator.Generate(random);
+
+	generationComplete = true;
+	generating = false;
+
+	std::cout << "Maze Generation Complete!\n";
+
+#ifdef DEBUG_PRINT_MAZE_ON_CONSOLE
+	PrintMaze();
+#endif
+}
+
+/*
+PURPOSE: Generates the whole maze at once with Eller's algorithm, see EllerGenerator. The rows are copied into the grid as they are emitted.
+*/
+void Maze::GenerateMazeEller()
+{
+	ResetGrid();
+	generating = true;
+
+	SeedRandom();
+
+	std::cout << "Eller Maze Generation Started\n";
+
+	EllerGenerator generator(width, height);
+	generator.Generate(random, [this](int y, const std::vector<uint8_t>& row) {
+		std::copy(row.begin(), row.end(), cells.begin() + (size_t)y * width);
+	});
+
+	generationComplete = true;
+	generating = false;
+
+	std::cout << "Maze Generation Complete!\n";
+
+#ifdef DEBUG_PRINT_MAZE_ON_CONSOLE
+	PrintMaze();
+#endif
+}
+
+void Maze::StartSelection()
+{
+	selectingCells = true;
+}
+
+/*
+PURPOSE: Selects start and end points directly, it is used instead of UpdateSelection when there is no mouse (e.g. headless runs)
+*/
+void Maze::SelectSolveCells(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	solveStartCell = startCell;
+	SetWall(solveStartCell, false);
+	hasSolveStartCell = true;
+
+	solveEndCell = endCell;
+	SetWall(solveEndCell, false);
+	hasSolveEndCell = true;
+
+	selectionPhase = Utils::SelectionPhase::SelectingEnd;
+	selectionComplete = true;
+	selectingCells = false;
+	pointing = false;
+}
+
+/*
+PURPOSE: Finds the longest path with two breadth first searches (exact on perfect mazes) and selects its ends,
+	the distance field stays computed from the start cell
+*/
+int Maze::SelectFarthestCells()
+{
+	Utils::CellIndex anyCell = 0;
+	while (anyCell < GetCellCount() && IsWall(anyCell))
+		anyCell++;
+
+	if (anyCell == GetCellCount())
+		return -1;
+
+	if (!distanceField)
+		distanceField = std::make_unique<DistanceField>(*this);
+
+	Utils::CellIndex farthestStartCell = Utils::INVALID_CELL;
+	Utils::CellIndex farthestEndCell = Utils::INVALID_CELL;
+	int distance = distanceField->FindDiameter(anyCell, farthestStartCell, farthestEndCell);
+
+	SelectSolveCells(farthestStartCell, farthestEndCell);
+
+	std::cout << "Farthest cells selected, (" << GetCellX(solveStartCell) << ", " << GetCellY(solveStartCell) << ") and (" << GetCellX(solveEndCell) << ", " << GetCellY(solveEndCell) << ") are " << distance << " cells apart\n";
+	return distance;
+}
+
+void Maze::ComputeDistanceField(Utils::CellIndex sourceCell)
+{
+	if (!distanceField)
+		distanceField = std::make_unique<DistanceField>(*this);
+
+	distanceField->Compute(sourceCell);
+}
+
+/*
+PURPOSE: Assigns costs from two octaves of value noise, random values on lattices of <featureSize> and <featureSize> / 2 cells blended with smoothstep.
+	The lower half of the noise is dry ground of cost 1, the upper half rises to <maxCost>, so cheap corridors wind between patches of mud and water.
+	Costs have their own stream, so the same seed gives the same costs whatever the solver did before.
+*/
+void Maze::GenerateCellCosts(int featureSize, int maxCost)
+{
+	featureSize = std::max(featureSize, 2);
+	maxCost = std::clamp(maxCost, 1, 255);
+
+	/* Two long jumps away from the generation stream and one away from the solving stream of the same seed */
+	Random costRandom(seed);
+	costRandom.LongJump();
+	costRandom.LongJump();
+
+	std::vector<float> noise(GetCellCount(), 0.0f);
+	std::vector<float> lattice;
+
+	const int spacings[2] = { featureSize, std::max(featureSize / 2, 1) };
+	const float weights[2] = { 2.0f / 3.0f, 1.0f / 3.0f };
+
+	for (int octave = 0; octave < 2; ++octave) {
+		const int spacing = spacings[octave];
+		const int latticeWidth = width / spacing + 2;
+		const int latticeHeight = height / spacing + 2;
+
+		lattice.resize((size_t)latticeWidth * latticeHeight);
+		for (auto& value : lattice)
+			value = costRandom.NextFloat();
+
+		for (int y = 0; y < height; ++y) {
+			const int latticeY = y / spacing;
+			float ty = (float)(y % spacing) / spacing;
+			ty = ty * ty * (3.0f - 2.0f * ty);
+
+			const float* row0 = &lattice[(size_t)latticeY * latticeWidth];
+			const float* row1 = row0 + latticeWidth;
+
+			for (int x = 0; x < width; ++x) {
+				const int latticeX = x / spacing;
+				float tx = (float)(x % spacing) / spacing;
+				tx = tx * tx * (3.0f - 2.0f * tx);
+
+				float top = row0[latticeX] + (row0[latticeX + 1] - row0[latticeX]) * tx;
+				float bottom = row1[latticeX] + (row1[latticeX + 1] - row1[latticeX]) * tx;
+
+				noise[(size_t)y * width + x] += (top + (bottom - top) * ty) * weights[octave];
+			}
+		}
+	}
+
+	cellCosts.resize(GetCellCount());
+
+	for (size_t i = 0; i < noise.size(); ++i) {
+		float depth = std::max(noise[i] - 0.5f, 0.0f) * 2.0f;
+		cellCosts[i] = (uint8_t)std::min(1 + (int)(depth * maxCost), maxCost);
+	}
+
+	std::cout << "Cell costs generated from seed " << seed << " with " << featureSize << " cell features and costs up to " << maxCost << "\n";
+}
+
+/* UNUSED FUNCTION */
+void Maze::GenerateStep(Utils::CellIndex cell)
+{
+	SetWall(cell, false); // Mark cell as part of the maze
+
+	for(int i = 0; i < 4; ++i) {
+		Utils::CellIndex nextCell = GetCellTowardsDirection(cell, Utils::GetDirection(i), 2);
+
+		if (nextCell != Utils::INVALID_CELL && IsWall(nextCell)) {
+			GenerateStep(nextCell);
+		}
+	}
+}
+
+/*
+PURPOSE: Unmarks the second pass of the entrances which are shared by two neighbor junctions.
+	Neighbor junctions are found through the junction flag of the cells around each junction,
+	so the cost is linear in the number of junctions.
+*/
+void Maze::FixNeighborJunctions()
+{
+	for (const auto& j0 : junctions) {
+		int j0X = GetCellX(j0);
+		int j0Y = GetCellY(j0);
+
+		for (int distY = 0; distY <= 2; ++distY) {
+			for (int distX = -2; distX <= 2; ++distX) {
+				/* Visit each pair of junctions only once */
+				if (distY == 0 && distX <= 0)
+					continue;
+
+				Utils::CellIndex j1 = GetCellFromXY(j0X + distX, j0Y + distY);
+
+				if (j1 == Utils::INVALID_CELL || !IsJunction(j1))
+					continue;
+
+				Utils::CellIndex entranceCell = GetCellFromXY((j0X + GetCellX(j1)) / 2, (j0Y + GetCellY(j1)) / 2);
+
+				if (IsWall(entranceCell))
+					continue;
+
+				if (GetPassCount(entranceCell) == 2)
+					SetPassCount(entranceCell, 1);
+			}
+		}
+	}
+}
+
+void Maze::ClearJunctions()
+{
+	for (const auto& junction : junctions)
+		cells[junction] &= ~Utils::CELL_JUNCTION;
+
+	junctions.clear();
+}
+
+void Maze::PassOnEntrance(Utils::CellIndex cell)
+{
+	int passCount = GetPassCount(cell);
+
+	if (passCount == 0)
+		passedEntrances.push_back(cell);
+
+	if (passCount < Utils::MAX_PASS_COUNT)
+		SetPassCount(cell, passCount + 1);
+}
+
+void Maze::SetPassCount(Utils::CellIndex cell, int passCount)
+{
+	cells[cell] = (uint8_t)((cells[cell] & ~Utils::CELL_PASS_COUNT_MASK) | (passCount << Utils::CELL_PASS_COUNT_SHIFT));
+}
+
+/*
+PURPOSE: Resets pass counts by visiting only the passed cells instead of the whole grid
+*/
+void Maze::ClearPassCounts()
+{
+	for (const auto& cell : passedEntrances)
+		SetPassCount(cell, 0);
+
+	passedEntrances.clear();
+}
+
+void Maze::SeedRandom()
+{
+	/* Use the explicitly set seed, the pre-entered seed or a random one */
+	if (!hasSeed) {
+#ifdef MAZE_SEED
+		seed = MAZE_SEED;
+
+		std::cout << "Using pre-entered maze seed: " << MAZE_SEED << std::endl;
+#else
+		seed = Random::GenerateRandomSeed();
+#endif
+		hasSeed = true;
+	}
+
+	random.Seed(seed);
+
+	std::cout << "Maze seed: " << seed << std::endl;
+}
+
+/*
+PURPOSE: Clamps cell indices to be within grid bounds, so the pointed cell follows the mouse along the bounds when it leaves the maze
+*/
+bool Maze::ClampToGrid(int& cellX, int& cellY) const
+{
+	bool inside = cellX >= 0 && cellX < width && cellY >= 0 && cellY < height;
+
+	if (cellX < 0) cellX = 0;
+	if (cellX >= width) cellX = width - 1;
+
+	if (cellY < 0) cellY = 0;
+	if (cellY >= height) cellY = height - 1;
+
+	return inside;
+}
+
+std::vector<Utils::Direction> Maze::GetMovableDirections(Utils::CellIndex cell)
+{
+	std::vector<Utils::Direction> movableDirections;
+
+	for (int i = 0; i < 4; ++i) {
+		Utils::CellIndex nextCell = GetCellTowardsDirection(cell, Utils::GetDirection(i));
+
+		if (nextCell == Utils::INVALID_CELL)
+			continue;
+		
+		if (IsWall(nextCell))
+			continue;
+
+		movableDirections.push_back(Utils::GetDirection(i));
+	}
+
+	return movableDirections;
+}
+
+Utils::CellIndex Maze::GetCellFromXY(int x, int y) const
+{
+	if (x >= 0 && x <= width - 1 && y >= 0 && y <= height - 1) {
+		return y * width + x;
+	}
+	else
+		return Utils::INVALID_CELL;
+}
+
+Utils::CellIndex Maze::GetCellTowardsDirection(Utils::CellIndex cell, Utils::Direction direction, int multiply) const
+{
+	return GetCellFromXY(GetCellX(cell) + direction.first * multiply, GetCellY(cell) + direction.second * multiply);
+}
+
+void Maze::UpdateGeneration()
+{
+	/*
+		Here we are stepping on generation process
+		each call to this function should progress the maze generation
+		until it is complete.
+	*/
+
+	bool stepped = false;
+
+	if (stepGenerator) {
+		stepped = stepGenerator->Step(random);
+	}
+	else if (!generationStack.empty()) {
+		stepped = true;
+
+		currentCell = generationStack.back();
+		generationStack.pop_back();
+		
+		// Find unvisited neighbors
+		Utils::CellIndex unvisitedNeighbors[4];
+		int unvisitedNeighborCount = 0;
+		for (int i = 0; i < 4; ++i) {
+			Utils::CellIndex nextCell = GetCellTowardsDirection(currentCell, Utils::GetDirection(i), 2);
+
+			if (nextCell == Utils::INVALID_CELL)
+				continue;
+
+			if (!IsWall(nextCell))
+				continue;
+
+			unvisitedNeighbors[unvisitedNeighborCount++] = nextCell;
+		}
+
+		if (unvisitedNeighborCount > 0) {
+			generationStack.push_back(currentCell); // Push current cell back to stack
+			
+			int selectedNeighborIndex = random.NextInt(unvisitedNeighborCount);
+			Utils::CellIndex selectedNeighbor = unvisitedNeighbors[selectedNeighborIndex];
+
+			// Remove wall between current cell and selected neighbor, row-major indices make it the midpoint
+			SetWall((currentCell + selectedNeighbor) / 2, false);
+
+			SetWall(selectedNeighbor, false);
+			generationStack.push_back(selectedNeighbor);
+		}
+	}
+
+	if (!stepped) {
+		stepGenerator.reset();
+
+		generationComplete = true;
+		generating = false;
+
+		std::cout << "Maze Generation Complete!\n";
+
+#ifdef DEBUG_PRINT_MAZE_ON_CONSOLE
+		PrintMaze();
+#endif
+	}
+}
+
+void Maze::UpdateSelection(int cellX, int cellY, bool leftMouseClicked)
+{
+	bool mouseInsideMaze = ClampToGrid(cellX, cellY);
+
+	/* Do some checks to avoid point to the walls on inside of the map */
+	Utils::CellIndex cell = GetCellFromXY(cellX, cellY);
+
+	bool isWall = IsWall(cell);
+	bool isBound = cellX == 0 || cellX == width - 1 || cellY == 0 || cellY == height - 1;
+
+	bool hasNeighborWall = false;
+
+	if (cellX == 0 && IsWall(cell + 1)) hasNeighborWall = true; // Left
+	if (cellX == width - 1 && IsWall(cell - 1)) hasNeighborWall = true; // Right
+	if (cellY == 0 && IsWall(cell + width)) hasNeighborWall = true; // Down
+	if (cellY == height - 1 && IsWall(cell - width)) hasNeighborWall = true; // Up
+
+	/* Set pointed cell if there is no issue from the checks */
+	if((!isWall || (isBound && !hasNeighborWall)) && mouseInsideMaze) {
+		pointedCell = cell; //Checks have already been done before
+		pointing = true;
+	}
+	else {
+		pointing = false;
+	}
+
+	/* Cell selections to choose start and end points */
+	if(leftMouseClicked && pointing && !selectionComplete) {
+		if(selectionPhase == Utils::SelectionPhase::SelectingStart) {
+			solveStartCell = pointedCell;
+
+			if(IsWall(solveStartCell))
+				SetWall(solveStartCell, false);
+			
+			hasSolveStartCell = true;
+			
+			selectionPhase = Utils::SelectionPhase::SelectingEnd;
+			std::cout << "Start Cell Selected at (" << GetCellX(solveStartCell) << ", " << GetCellY(solveStartCell) << ")\n";
+		}
+		else if(selectionPhase == Utils::SelectionPhase::SelectingEnd) {
+			solveEndCell = pointedCell;
+
+			if (IsWall(solveEndCell))
+				SetWall(solveEndCell, false);
+
+			hasSolveEndCell = true;
+
+			selectionComplete = true;
+			selectingCells = false;
+
+			std::cout << "End Cell Selected at (" << GetCellX(solveEndCell) << ", " << GetCellY(solveEndCell) << ")\n";
+		}
+	}
+}
+
+void Maze::UpdateSolving()
+{
+	/* Other algorithms are stepped by their own solver */
+	if (stepSolver) {
+		if (stepSolver->Step())
+			return;
+
+		solving = false;
+		solvingComplete = true;
+
+		if (stepSolver->IsPathFound())
+			std::cout << "Solve path found with " << stepSolver->GetPath().size() << " cells after expanding " << stepSolver->GetExpandedCount() << " cells\n";
+		else
+			std::cout << "There is no path between the selected cells\n";
+		return;
+	}
+
+	bool movable = true;
+
+	/* Get movable direction of the current cell */
+	std::vector<Utils::Direction> movableDirections = GetMovableDirections(currentSolveCell);
+
+	Utils::Direction nextDirection{};
+
+	/* Decide the direction we will move */
+	if (movableDirections.size() <= 2) {
+		/* We are in a passage */
+
+		if (movableDirections.size() == 2) {
+			/* Only go forward */
+			std::erase(movableDirections, Utils::GetInvertedDirection(currentDirection));
+		}
+
+		nextDirection = movableDirections[0];
+	}
+	else {
+		/* We are in a junction */
+		
+		/* Store this junction cell */
+		if (!IsJunction(currentSolveCell)) {
+			cells[currentSolveCell] |= Utils::CELL_JUNCTION;
+			junctions.push_back(currentSolveCell);
+		}
+
+		/* Pass the previous entrance */
+		Utils::CellIndex previousCell = GetCellTowardsDirection(currentSolveCell, Utils::GetInvertedDirection(currentDirection));
+
+		PassOnEntrance(previousCell);
+
+		/* Get passed entrances */
+		std::vector<Utils::Direction> unpassedDirections;
+
+		/* Set those variables */
+		bool isOnlyPassedPrevious = true;
+		bool isAllEntrancesPassed = true;
+
+		for (const auto& direction : movableDirections) {
+			Utils::CellIndex nextCell = GetCellTowardsDirection(currentSolveCell, direction);
+
+			if (!IsPassedEntrance(nextCell)) {
+				unpassedDirections.push_back(direction);
+
+				isAllEntrancesPassed = false;
+			}
+			else {
+				if (nextCell != previousCell)
+					isOnlyPassedPrevious = false;
+			}
+		}
+		if (isOnlyPassedPrevious) {
+			/* Select an random unpassed entrance */
+			if (!unpassedDirections.empty()) {
+				int selectedIndex = solveRandom.NextInt((int)unpassedDirections.size());
+				nextDirection = unpassedDirections[selectedIndex];
+			}
+		}
+		else if (isAllEntrancesPassed && GetPassCount(previousCell) < 2) {
+			/* All entrances are passed, go back */
+			Utils::Direction invDirection = Utils::GetInvertedDirection(currentDirection);
+			nextDirection = invDirection;
+		}
+		else {
+			/* Select any entrance with the fewest passed */
+			int minPassCount = INT_MAX;
+			std::vector<Utils::Direction> leastPassedDirections;
+
+			for (const auto& direction : movableDirections) {
+				Utils::CellIndex nextCell = GetCellTowardsDirection(currentSolveCell, direction);
+
+				int passCount = GetPassCount(nextCell);
+				
+				if (passCount < minPassCount) {
+					minPassCount = passCount;
+					leastPassedDirections.clear();
+					leastPassedDirections.push_back(direction);
+				}
+				else if (passCount == minPassCount) {
+					leastPassedDirections.push_back(direction);
+				}
+			}
+			/* Select a random direction from least passed directions */
+			if (!leastPassedDirections.empty()) {
+				int selectedIndex = solveRandom.NextInt((int)leastPassedDirections.size());
+				nextDirection = leastPassedDirections[selectedIndex];
+			}
+		}
+
+		Utils::CellIndex nextCell = GetCellTowardsDirection(currentSolveCell, nextDirection);
+
+		PassOnEntrance(nextCell);
+	}
+
+	currentDirection = nextDirection;
+
+	/* Mode the current cell */
+	if (movable) {
+		/* To prevent wrong direction selection in completion phase */
+		if (currentSolveCell == solveStartCell)
+			startDirection = currentDirection;
+
+		currentSolveCell = GetCellTowardsDirection(currentSolveCell, currentDirection);
+	}
+
+	/* If we reach the finish */
+	if (currentSolveCell == solveEndCell) {
+		FixNeighborJunctions();
+
+		solving = false;
+		solvingComplete = true;
+	}
+}
+
+void Maze::UpdateCompletion()
+{
+	/* Step solvers already know the path, it is displayed one cell at a time */
+	if (stepSolver) {
+		const std::vector<Utils::CellIndex>& path = stepSolver->GetPath();
+
+		if (completionPathIndex + 1 >= path.size()) {
+			completing = false;
+			completionComplete = true;
+
+			std::cout << "Displayed solve path" << std::endl;
+			return;
+		}
+
+		currentCompleteCell = path[completionPathIndex++];
+		solvePath.push_back(currentCompleteCell);
+		return;
+	}
+
+	/* Get movable direction of the current cell */
+	std::vector<Utils::Direction> movableDirections = GetMovableDirections(currentCompleteCell);
+
+	Utils::Direction nextDirection{};
+
+	/* Decide the direction we will move */
+	if (movableDirections.size() <= 2) {
+		/* We are in a passage */
+
+		if (movableDirections.size() == 2) {
+			/* Only go forward */
+			std::erase(movableDirections, Utils::GetInvertedDirection(currentCompletionDirection));
+		}
+
+		nextDirection = movableDirections[0];
+	}
+	else {
+		/*	
+			We are in a junction
+			We will move on the once passed entrance
+		*/
+
+		/* Remove our backward to make our once passed entrances only one */
+		std::erase(movableDirections, Utils::GetInvertedDirection(currentCompletionDirection));
+
+		for (const auto& direction : movableDirections) {
+			/* Get next cell in the direcion */
+			Utils::CellIndex nextCell = GetCellTowardsDirection(currentCompleteCell, direction);
+			if (IsOncePassedEntrance(nextCell)) {
+				/* We will move on this direction */
+				nextDirection = direction;
+
+				break;
+			}
+		}
+
+		/* Marks may not lead anywhere (e.g. an entrance shared by neighbor junctions), stop instead of stepping in place forever */
+		if (nextDirection == Utils::Direction{}) {
+			completing = false;
+			completionComplete = true;
+
+			std::cout << "Solve path could not be completed from the marks" << std::endl;
+			return;
+		}
+	}
+
+	currentCompletionDirection = nextDirection;
+
+	currentCompleteCell = GetCellTowardsDirection(currentCompleteCell, currentCompletionDirection);
+
+	/* We have reached to end */
+	if (currentCompleteCell == solveEndCell) {
+		completing = false;
+		completionComplete = true;
+
+		std::cout << "Displayed solve path" << std::endl;
+		return;
+	}
+
+	solvePath.push_back(currentCompleteCell);
+}
+
+void Maze::SolveMaze()
+{
+	solving = true;
+	solvingComplete = false;
+
+	/* Start to use Tremaux's algorithm */
+
+	std::cout << "Maze Solving Started from (" << GetCellX(solveStartCell) << ", " << GetCellY(solveStartCell) << ") to (" << GetCellX(solveEndCell) << ", " << GetCellY(solveEndCell) << ")\n";
+
+	currentSolveCell = solveStartCell;
+	ClearPassCounts();
+
+	stepSolver.reset();
+
+	int threadCount = solvingThreadCount > 0 ? solvingThreadCount : (int)std::thread::hardware_concurrency();
+
+	switch (solvingAlgorithm)
+	{
+	case Utils::SolvingAlgorithm::BreadthFirst:
+		stepSolver = std::make_unique<BreadthFirstSolver>(*this);
+		break;
+	case Utils::SolvingAlgorithm::AStar:
+		stepSolver = std::make_unique<AStarSolver>(*this);
+		break;
+	case Utils::SolvingAlgorithm::Bidirectional:
+		stepSolver = std::make_unique<BidirectionalSolver>(*this);
+		break;
+	case Utils::SolvingAlgorithm::ParallelBreadthFirst:
+		stepSolver = std::make_unique<ParallelBreadthFirstSolver>(*this, threadCount);
+		break;
+	case Utils::SolvingAlgorithm::Bitboard:
+		stepSolver = std::make_unique<BitboardSolver>(*this);
+		break;
+	case Utils::SolvingAlgorithm::DeadEndFilling:
+		stepSolver = std::make_unique<DeadEndSolver>(*this, threadCount);
+		break;
+	case Utils::SolvingAlgorithm::Dijkstra:
+		stepSolver = std::make_unique<DijkstraSolver>(*this);
+		break;
+	default:
+		break;
+	}
+
+	if (stepSolver) {
+		stepSolver->Start(solveStartCell, solveEndCell);
+		return;
+	}
+
+	/* Solver has its own stream, 2^192 steps away from the generation stream of the same seed */
+	solveRandom.Seed(seed);
+	solveRandom.LongJump();
+	ClearJunctions();
+}
+
+std::vector<BatchSolver::Result> Maze::SolveBatch(std::span<const BatchSolver::Query> queries, bool keepPaths) const
+{
+	if (!batchSolver) {
+		int threadCount = solvingThreadCount > 0 ? solvingThreadCount : (int)std::thread::hardware_concurrency();
+		batchSolver = std::make_unique<BatchSolver>(*this, threadCount);
+	}
+
+	return batchSolver->SolveBatch(queries, keepPaths);
+}
+
+void Maze::CompleteMaze()
+{
+	completing = true;
+	completionComplete = false;
+	solvingComplete = false;
+
+	std::cout << "Maze Completion Started from (" << GetCellX(solveStartCell) << ", " << GetCellY(solveStartCell) << ") to (" << GetCellX(solveEndCell) << ", " << GetCellY(solveEndCell) << ")\n";
+
+	/* Start solve path */
+	currentCompletionDirection = startDirection;
+	currentCompleteCell = solveStartCell;
+
+	solvePath.clear();
+	completionPathIndex = 1; // Path of a step solver starts with the start cell
+}
+
+/*
+PURPOSE: Solves the selected points once with LPA*, later wall toggles only repair what they change.
+	Marks of the other solvers don't match the edited maze, so they are cleared.
+*/
+void Maze::StartEditing()
+{
+	if (!generationComplete || !hasSolveStartCell || !hasSolveEndCell)
+		return;
+
+	StopExitSelection();
+
+	stepSolver.reset();
+	distanceField.reset();
+	ClearPassCounts();
+	ClearJunctions();
+
+	lpaStarSolver = std::make_unique<LpaStarSolver>(*this);
+	lpaStarSolver->Solve(solveStartCell, solveEndCell);
+
+	const std::vector<Utils::CellIndex>& path = lpaStarSolver->GetPath();
+
+	solvePath.clear();
+	if (path.size() > 2)
+		solvePath.assign(path.begin() + 1, path.end() - 1);
+
+	editing = true;
+	pointing = false;
+
+	std::cout << "Editing Started, click on cells to toggle walls\n";
+}
+
+void Maze::StopEditing()
+{
+	editing = false;
+	pointing = false;
+	lpaStarSolver.reset();
+}
+
+/*
+PURPOSE: Points the cells with the same math as the selection, bounds and the selected points can't be toggled.
+	A click toggles the wall of the pointed cell, then the repair runs until its budget of the frame runs out.
+*/
+void Maze::UpdateEditing(int cellX, int cellY, bool leftMouseClicked)
+{
+	if (!editing)
+		return;
+
+	bool mouseInsideMaze = ClampToGrid(cellX, cellY);
+
+	Utils::CellIndex cell = GetCellFromXY(cellX, cellY);
+	bool isBound = cellX == 0 || cellX == width - 1 || cellY == 0 || cellY == height - 1;
+
+	if (mouseInsideMaze && !isBound && cell != solveStartCell && cell != solveEndCell) {
+		pointedCell = cell;
+		pointing = true;
+	}
+	else {
+		pointing = false;
+	}
+
+	if (leftMouseClicked && pointing) {
+		SetWall(pointedCell, !IsWall(pointedCell));
+		lpaStarSolver->UpdateCell(pointedCell);
+
+		/* The heatmap would show the distances of the old maze */
+		distanceField.reset();
+		solvePath.clear();
+	}
+
+	if (!lpaStarSolver->IsRepairing() || !lpaStarSolver->Repair(EDITING_EXPANSIONS_PER_UPDATE))
+		return;
+
+	/* Solve path keeps only the cells between start and end */
+	const std::vector<Utils::CellIndex>& path = lpaStarSolver->GetPath();
+
+	if (path.size() > 2)
+		solvePath.assign(path.begin() + 1, path.end() - 1);
+
+	if (lpaStarSolver->IsPathFound())
+		std::cout << "Solve path repaired with " << path.size() << " cells after expanding " << lpaStarSolver->GetExpandedCount() << " cells\n";
+	else
+		std::cout << "There is no path between the selected cells, " << lpaStarSolver->GetExpandedCount() << " cells expanded\n";
+}
+
+/*
+PURPOSE: Starts with the end point as the only exit, so the field shows the same path as the solving
+*/
+void Maze::StartExitSelection()
+{
+	if (!generationComplete || !hasSolveStartCell || !hasSolveEndCell)
+		return;
+
+	StopEditing();
+
+	stepSolver.reset();
+	distanceField.reset();
+	ClearPassCounts();
+	ClearJunctions();
+
+	exitCells.assign(1, solveEndCell);
+	exitField = std::make_unique<ExitField>(*this);
+
+	selectingExits = true;
+	pointing = false;
+
+	std::cout << "Exit Selection Started, click on open cells to add or remove exits\n";
+	UpdateExitSelection(-1, -1, false);
+}
+
+void Maze::StopExitSelection()
+{
+	selectingExits = false;
+	pointing = false;
+	exitCells.clear();
+	exitField.reset();
+}
+
+/*
+PURPOSE: Points open cells with the same math as the selection, a click adds the pointed cell as an exit or removes it.
+	Every change computes the field again and the solve path goes to the nearest exit.
+*/
+void Maze::UpdateExitSelection(int cellX, int cellY, bool leftMouseClicked)
+{
+	if (!selectingExits)
+		return;
+
+	bool mouseInsideMaze = ClampToGrid(cellX, cellY);
+	Utils::CellIndex cell = GetCellFromXY(cellX, cellY);
+
+	if (mouseInsideMaze && !IsWall(cell) && cell != solveStartCell) {
+		pointedCell = cell;
+		pointing = true;
+	}
+	else {
+		pointing = false;
+	}
+
+	bool changed = !exitField->IsComputed();
+
+	if (leftMouseClicked && pointing) {
+		auto it = std::find(exitCells.begin(), exitCells.end(), pointedCell);
+
+		if (it != exitCells.end())
+			exitCells.erase(it);
+		else
+			exitCells.push_back(pointedCell);
+
+		changed = true;
+	}
+
+	if (!changed)
+		return;
+
+	exitField->Compute(exitCells);
+
+	std::vector<Utils::CellIndex> path;
+	solvePath.clear();
+
+	if (!exitField->GetNearestPath(solveStartCell, path)) {
+		std::cout << "None of the " << exitCells.size() << " exits can be reached\n";
+		return;
+	}
+
+	/* Solve path keeps only the cells between start and the exit */
+	if (path.size() > 2)
+		solvePath.assign(path.begin() + 1, path.end() - 1);
+
+	std::cout << "Nearest of " << exitCells.size() << " exits is (" << GetCellX(path.back()) << ", " << GetCellY(path.back()) << "), " << path.size() - 1 << " cells away\n";
+}
+
+void Maze::UpdateMaze(int pointedCellX, int pointedCellY, bool leftMouseClicked)
+{
+	if(generating && !generationComplete) {
+		UpdateGeneration();
+	}
+	if (selectingCells) {
+		UpdateSelection(pointedCellX, pointedCellY, leftMouseClicked);
+	}
+	if(solving && !solvingComplete) {
+		UpdateSolving();
+	}
+	if (completing && !completionComplete) {
+		UpdateCompletion();
+	}
+}
+
+void Maze::PrintMaze()
+{
+	for(int i = height - 1; i >= 0; --i) {
+		for(int j = 0; j < width; ++j) {
+			std::cout << (IsWall(GetCellFromXY(j, i)) ? "##" : "  ");
+		}
+		std::cout << std::endl;
+	}
+}
+
+void Maze::InitializeGrid()
+{
+	/* Make sure the maze size is odd */
+	if (width % 2 == 0)
+		width--;
+
+	if (height % 2 == 0)
+		height--;
+
+	ResetGrid();
+}
+
+/*
+PURPOSE: Makes every cell a wall again and drops the state of the last run, so generating again starts from a fresh grid
+*/
+void Maze::ResetGrid()
+{
+	/* Setup the variables */
+	generating = false;
+	generationComplete = false;
+	generationStack.clear();
+	stepGenerator.reset();
+	solving = false;
+	solvingComplete = false;
+	stepSolver.reset();
+	currentSolveCell = Utils::INVALID_CELL;
+	pointing = false;
+	selectingCells = false;
+	selectionComplete = false;
+	selectionPhase = Utils::SelectionPhase::SelectingStart;
+	hasSolveStartCell = false;
+	hasSolveEndCell = false;
+	passedEntrances.clear();
+	junctions.clear();
+	cellCosts.clear();
+	distanceField.reset();
+	batchSolver.reset();
+	solvePath.clear();
+	completing = false;
+	completionComplete = false;
+	currentCompleteCell = Utils::INVALID_CELL;
+
+	StopEditing();
+	StopExitSelection();
+
+	/* Allocate memory for grid, every cell starts as a wall */
+	cells.assign((size_t)width * height, Utils::CELL_WALL);
+}
+
+void Maze::CleanupGrid()
+{
+	/* Deallocate memory for grid */
+	cells.clear();
+	cells.shrink_to_fit();
+}
@@ -0,0 +1,285 @@
+#pragma once
+
+/*
+
+Maze class that represents a maze structure and provides functionality to generate and solve the maze.
+It has no dependency on OpenGL, renderers read its state through the const accessors below.
+
+Author: Ali Osman AHN
+
+Date: December 7, 2025
+
+*/
+
+#include "MazeSettings.h"
+#include "Utils.h"
+#include "Random.h"
+#include "StepGenerator.h"
+#include "StepSolver.h"
+#include "DistanceField.h"
+#include "LpaStarSolver.h"
+#include "BatchSolver.h"
+#include "ExitField.h"
+
+#include <vector>
+#include <stdlib.h>
+#include <iostream>
+#include <algorithm>
+#include <string>
+#include <cstdint>
+#include <climits>
+#include <memory>
+
+class Maze
+{
+public:
+    Maze() = delete;
+	Maze(int w, int h) : width(w), height(h) {
+		InitializeGrid();
+	}
+	Maze(int w, int h, uint64_t seed) : width(w), height(h), seed(seed), hasSeed(true) {
+		InitializeGrid();
+	}
+
+	Maze(const Maze& other) = delete;
+	Maze& operator=(const Maze& other) = delete;
+
+	~Maze() {
+		CleanupGrid();
+	}
+
+	void SetSeed(uint64_t newSeed) { seed = newSeed; hasSeed = true; } // Takes effect on the next generation, which starts from a fresh grid
+	uint64_t GetSeed() const { return seed; }
+
+	/* Take effect on the next GenerateMaze(), thread count 0 uses all cores */
+	void SetGenerationAlgorithm(Utils::GenerationAlgorithm algorithm) { generationAlgorithm = algorithm; }
+	Utils::GenerationAlgorithm GetGenerationAlgorithm() const { return generationAlgorithm; }
+	void SetGenerationThreadCount(int threadCount) { generationThreadCount = threadCount; }
+	void SetAldousBroderFraction(float fraction) { aldousBroderFraction = fraction; } // Share of the cells Wilson's algorithm adds with an Aldous-Broder walk first
+	void SetGrowingTreePolicy(Utils::GrowingTreePolicy policy, float newestWeight = 0.5f) { growingTreePolicy = policy; growingTreeNewestWeight = newestWeight; }
+
+	/* Take effect on the next SolveMaze(), thread count 0 uses all cores */
+	void SetSolvingAlgorithm(Utils::SolvingAlgorithm algorithm) { solvingAlgorithm = algorithm; }
+	Utils::SolvingAlgorithm GetSolvingAlgorithm() const { return solvingAlgorithm; }
+	void SetSolvingThreadCount(int threadCount) { solvingThreadCount = threadCount; batchSolver.reset(); }
+
+	void GenerateMaze();
+	void GenerateMazeTiled(int tileSize, int threadCount); // Parallel generation, runs to the end without stepping. Thread count 0 uses all cores
+	void GenerateMazeEller(); // Row by row generation with Eller's algorithm, runs to the end without stepping
+	void StartSelection();
+	void SelectSolveCells(Utils::CellIndex startCell, Utils::CellIndex endCell); // Select start and end points without mouse
+	int SelectFarthestCells(); // Selects the two ends of the longest path as start and end points, returns their distance
+	void SolveMaze();
+	void CompleteMaze();
+
+	/* Solves every pair independently on the solving threads, the maze must not change meanwhile and batches must not overlap. Start and end cells above are not used */
+	std::vector<BatchSolver::Result> SolveBatch(std::span<const BatchSolver::Query> queries, bool keepPaths = false) const;
+
+	void UpdateGeneration(); //	Iterative step for generation
+	void UpdateSelection(int cellX, int cellY, bool leftMouseClicked);  // Update selection process, pointed cell may be outside of the maze
+	void UpdateSolving();    // Iterative step for solving
+	void UpdateCompletion(); // Iteratice step for completion
+
+	void UpdateMaze(int pointedCellX, int pointedCellY, bool leftMouseClicked);
+	void PrintMaze(); // For debugging purposes, It prints the maze to console
+
+	bool IsGenerationComplete() const { return generationComplete; }
+	bool IsSolvingComplete() const { return solvingComplete; }
+	bool IsSelectionComplete() const { return selectionComplete; }
+	bool IsCompletionComplete() const { return completionComplete; }
+
+	/* Grid accessors, cells are addressed by their row-major index */
+	int GetWidth() const { return width; }
+	int GetHeight() const { return height; }
+	int GetCellCount() const { return width * height; }
+
+	int GetCellX(Utils::CellIndex cell) const { return cell % width; }
+	int GetCellY(Utils::CellIndex cell) const { return cell / width; }
+
+	bool IsWall(Utils::CellIndex cell) const { return (cells[cell] & Utils::CELL_WALL) != 0; }
+	const uint8_t* GetCellData() const { return cells.data(); } // Raw cell states for passes over whole rows
+	void SetWall(Utils::CellIndex cell, bool isWall) {
+		if (isWall) cells[cell] |= Utils::CELL_WALL;
+		else cells[cell] &= ~Utils::CELL_WALL;
+	}
+
+	/* Tremaux marks, entrance cells count how many times they are passed */
+	int GetPassCount(Utils::CellIndex cell) const { return (cells[cell] & Utils::CELL_PASS_COUNT_MASK) >> Utils::CELL_PASS_COUNT_SHIFT; }
+	bool IsPassedEntrance(Utils::CellIndex cell) const { return GetPassCount(cell) != 0; }
+	bool IsOncePassedEntrance(Utils::CellIndex cell) const { return GetPassCount(cell) == 1; }
+
+	bool IsJunction(Utils::CellIndex cell) const { return (cells[cell] & Utils::CELL_JUNCTION) != 0; } // Junctions met by the solver
+
+	Utils::CellIndex GetCellFromXY(int x, int y) const;
+	Utils::CellIndex GetCellTowardsDirection(Utils::CellIndex cell, Utils::Direction direction, int multiply = 1) const;
+
+	/* State accessors used by renderers */
+	bool IsGenerating() const { return generating; }
+	Utils::CellIndex GetGenerationHeadCell() const {
+		if (stepGenerator)
+			return stepGenerator->GetHeadCell();
+		return generationStack.empty() ? Utils::INVALID_CELL : generationStack.back();
+	}
+
+	bool IsSelectingCells() const { return selectingCells; }
+	bool IsPointing() const { return pointing; }
+	Utils::CellIndex GetPointedCell() const { return pointedCell; }
+
+	bool HasSolveStartCell() const { return hasSolveStartCell; }
+	bool HasSolveEndCell() const { return hasSolveEndCell; }
+	Utils::CellIndex GetSolveStartCell() const { return solveStartCell; }
+	Utils::CellIndex GetSolveEndCell() const { return solveEndCell; }
+
+	bool IsSolving() const { return solving; }
+	Utils::CellIndex GetCurrentSolveCell() const { return stepSolver ? stepSolver->GetHeadCell() : currentSolveCell; }
+	const StepSolver* GetStepSolver() const { return stepSolver.get(); } // Null for Tremaux
+	const std::vector<Utils::CellIndex>& GetPassedEntrances() const { return passedEntrances; } // Only the cells having a pass count
+
+	/* Distances of every cell from one source cell, null until computed, generating a new maze clears it */
+	void ComputeDistanceField(Utils::CellIndex sourceCell);
+	void ClearDistanceField() { distanceField.reset(); }
+	const DistanceField* GetDistanceField() const { return distanceField.get(); }
+
+	/* Costs of entering the cells (mud, water), only the Dijkstra solver reads them. Without costs every cell costs 1, generating a new maze clears them */
+	void GenerateCellCosts(int featureSize, int maxCost); // Seeded noise field with blobs about <featureSize> cells wide, costs are in [1, maxCost], maxCost is at most 255
+	void SetCellCost(Utils::CellIndex cell, uint8_t cost) {
+		if (cellCosts.empty())
+			cellCosts.assign(GetCellCount(), 1);
+		cellCosts[cell] = cost;
+	}
+	int GetCellCost(Utils::CellIndex cell) const { return cellCosts.empty() ? 1 : cellCosts[cell]; }
+	bool HasCellCosts() const { return !cellCosts.empty(); }
+	void ClearCellCosts() { cellCosts.clear(); }
+	const uint8_t* GetCostData() const { return cellCosts.empty() ? nullptr : cellCosts.data(); } // Null without costs
+
+	bool IsCompleting() const { return completing; }
+	Utils::CellIndex GetCurrentCompleteCell() const { return currentCompleteCell; }
+	const std::vector<Utils::CellIndex>& GetSolvePath() const { return solvePath; } // Cells between start and end
+
+	/* Wall editing after the path is found, every toggled wall repairs the solve path incrementally instead of solving again */
+	void StartEditing();
+	void StopEditing();
+	void UpdateEditing(int cellX, int cellY, bool leftMouseClicked); // Pointed cell may be outside of the maze
+	bool IsEditing() const { return editing; }
+	bool IsRepairingPath() const { return lpaStarSolver && lpaStarSolver->IsRepairing(); }
+
+	/* Exit selection after the path is found, the end point is the first exit. One search from all exits gives their regions and the path to the nearest one */
+	void StartExitSelection();
+	void StopExitSelection();
+	void UpdateExitSelection(int cellX, int cellY, bool leftMouseClicked); // Pointed cell may be outside of the maze
+	bool IsSelectingExits() const { return selectingExits; }
+	const ExitField* GetExitField() const { return exitField.get(); } // Null unless exits are being selected
+
+private:
+	void InitializeGrid();
+	void ResetGrid(); // Every cell becomes a wall again and the state of the last run is dropped
+	void CleanupGrid();
+
+private:
+	void GenerateStep(Utils::CellIndex cell); // A single recursive step in maze generation
+
+private:
+	void FixNeighborJunctions();
+	void ClearJunctions();
+
+	void PassOnEntrance(Utils::CellIndex cell);
+	void SetPassCount(Utils::CellIndex cell, int passCount);
+	void ClearPassCounts();
+	
+private:
+	/* Helpers */
+	std::vector<Utils::Direction> GetMovableDirections(Utils::CellIndex cell);
+	bool ClampToGrid(int& cellX, int& cellY) const; // Returns true if the cell was inside of the grid before clamping
+	void SeedRandom(); // Picks the seed if it is not set and restarts the generation stream
+
+private:
+	int width;
+    int height;
+
+	std::vector<uint8_t> cells; // Hold all grid as one contiguous row-major array of cell states
+	std::vector<Utils::CellIndex> junctions; //Hold all junctions, each one also has the CELL_JUNCTION flag
+	std::vector<uint8_t> cellCosts; // Parallel to the cells, empty if every cell costs 1
+
+private:
+	/* Every maze owns its random streams, so mazes on different threads never share a sequence */
+	uint64_t seed = 0;
+	bool hasSeed = false;
+
+	Random random;      // Generation stream
+	Random solveRandom; // Solving stream
+
+private:
+	/* Variables to generate the maze */
+	bool generating = false;
+	bool generationComplete = false;
+
+	Utils::CellIndex startCell = Utils::INVALID_CELL; // Starting point for maze generation
+	Utils::CellIndex currentCell = Utils::INVALID_CELL; // Current cell being processed
+	std::vector<Utils::CellIndex> generationStack; // Stack for iterative generation
+
+	Utils::GenerationAlgorithm generationAlgorithm = Utils::GenerationAlgorithm::Backtracker;
+	int generationThreadCount = 0;
+	float aldousBroderFraction = 0.0f;
+	Utils::GrowingTreePolicy growingTreePolicy = Utils::GrowingTreePolicy::Newest;
+	float growingTreeNewestWeight = 0.5f;
+	std::unique_ptr<StepGenerator> stepGenerator; // Steps every algorithm except the backtracker
+
+private:
+	/* Variables to solve the maze */
+	bool solving = false;
+	bool solvingComplete = false;
+
+	Utils::CellIndex currentSolveCell = Utils::INVALID_CELL; // Current cell being processed in solving
+	Utils::Direction currentDirection;
+
+	std::vector<Utils::CellIndex> passedEntrances; // Compact index of the cells whose pass count is not zero
+
+	Utils::SolvingAlgorithm solvingAlgorithm = Utils::SolvingAlgorithm::Tremaux;
+	int solvingThreadCount = 0;
+	std::unique_ptr<StepSolver> stepSolver; // Solves with every algorithm except Tremaux
+
+	std::unique_ptr<DistanceField> distanceField;
+	mutable std::unique_ptr<BatchSolver> batchSolver; // Kept between batches so the scratch buffers of the threads are reused, dropped with the grid
+
+private:
+	/* Variables to complete the maze */
+	bool completing = false;
+	bool completionComplete = false;
+
+	Utils::Direction startDirection;
+	Utils::Direction currentCompletionDirection;
+
+	Utils::CellIndex currentCompleteCell = Utils::INVALID_CELL;
+	size_t completionPathIndex = 0; // Next cell of the step solver path to display
+	
+	std::vector<Utils::CellIndex> solvePath;
+
+private:
+	/* Variables to edit the maze */
+	bool editing = false;
+	std::unique_ptr<LpaStarSolver> lpaStarSolver;
+
+	static constexpr uint64_t EDITING_EXPANSIONS_PER_UPDATE = 32768; // Repair budget of a frame, longer repairs continue on the next frames
+
+private:
+	/* Variables to select exits */
+	bool selectingExits = false;
+	std::vector<Utils::CellIndex> exitCells;
+	std::unique_ptr<ExitField> exitField;
+
+private:
+	/* Those are user selected */
+	Utils::CellIndex solveStartCell = Utils::INVALID_CELL; // Starting point for maze solving
+	bool hasSolveStartCell = false;
+
+	Utils::CellIndex solveEndCell = Utils::INVALID_CELL;   // Ending point for maze solving
+	bool hasSolveEndCell = false;
+
+	Utils::CellIndex pointedCell = Utils::INVALID_CELL; // Currently pointed cell by mouse
+	bool pointing = false;
+
+	bool selectingCells = false; // Flag to indicate if we are in cell selection mode
+	bool selectionComplete = false;
+	Utils::SelectionPhase selectionPhase = Utils::SelectionPhase::SelectingStart;
+};
+
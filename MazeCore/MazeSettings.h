@@ -0,0 +1,21 @@
+#pragma once
+
+/*
+
+This file contains configurable parameters and preprocessor definitions used by the maze core library.
+It is independent from the window and the renderer, so it can be used on headless builds too.
+
+*/
+
+/* ------- SETTINGS ------- */
+
+/*
+Change this value to generate maze from a seed, it is a 64 bit unsigned value.
+If it is commented, the seed will be generated randomly
+Seeds set with Maze::SetSeed() or the Maze constructor are used instead of this one
+*/
+//#define MAZE_SEED 0
+
+/* ------- DEBUG ------- */
+
+//#define DEBUG_PRINT_MAZE_ON_CONSOLE // Uncomment this line to print maze into console after generation (might not work with large mazes)
@@ -0,0 +1,416 @@
+#include "ParallelBreadthFirstSolver.h"
+#include "Maze.h"
+
+#include <thread>
+#include <atomic>
+#include <bit>
+#include <algorithm>
+
+ParallelBreadthFirstSolver::ParallelBreadthFirstSolver(const Maze& maze, int threadCount) : maze(maze), threadCount(threadCount)
+{
+	if (this->threadCount < 1)
+		this->threadCount = 1;
+
+	workerFrontiers.resize(this->threadCount);
+}
+
+void ParallelBreadthFirstSolver::Start(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	this->startCell = startCell;
+	this->endCell = endCell;
+
+	const int cellCount = maze.GetCellCount();
+	const size_t wordCount = ((size_t)cellCount + 63) / 64;
+
+	parents.assign(cellCount, UNVISITED);
+
+	/* Open cells start as unvisited */
+	unvisitedBits.resize(wordCount);
+
+	size_t blockCount = (wordCount + BOTTOM_UP_BLOCK_SIZE - 1) / BOTTOM_UP_BLOCK_SIZE;
+	blockCounts.assign(blockCount, 0);
+
+	RunOnBlocks(blockCount, [&](size_t block, int /* worker */) {
+		size_t wordEnd = std::min((block + 1) * BOTTOM_UP_BLOCK_SIZE, wordCount);
+		size_t count = 0;
+
+		for (size_t word = block * BOTTOM_UP_BLOCK_SIZE; word < wordEnd; ++word) {
+			uint64_t bits = 0;
+
+			for (int bit = 0; bit < 64; ++bit) {
+				Utils::CellIndex cell = (Utils::CellIndex)(word * 64 + bit);
+
+				if (cell < cellCount && !maze.IsWall(cell))
+					bits |= (uint64_t)1 << bit;
+			}
+
+			unvisitedBits[word] = bits;
+			count += std::popcount(bits);
+		}
+
+		blockCounts[block] = count;
+	});
+
+	openCount = 0;
+	for (size_t count : blockCounts)
+		openCount += count;
+
+	path.clear();
+	pathFound = false;
+	expandedCount = 0;
+	layer = 0;
+	bottomUpLayerCount = 0;
+
+	parents[startCell] = ROOT_PARENT;
+	unvisitedBits[startCell / 64] &= ~((uint64_t)1 << (startCell % 64));
+
+	if (distances)
+		(*distances)[startCell] = 0;
+
+	frontier.assign(1, startCell);
+	frontierSize = 1;
+	unvisitedCount = openCount - 1;
+	bottomUp = false;
+
+	searching = true;
+
+	if (startCell == endCell) {
+		BuildPath();
+		searching = false;
+	}
+}
+
+/*
+PURPOSE: Expands the whole frontier into the next distance layer, top down or bottom up by the frontier size
+*/
+bool ParallelBreadthFirstSolver::Step()
+{
+	if (!searching)
+		return false;
+
+	if (frontierSize == 0) {
+		searching = false;
+		return false;
+	}
+
+	expandedCount += frontierSize;
+
+	/* Bottom up stays while the frontier is still a large share of the open cells, so it doesn't flip every layer near the end */
+	bool useBottomUp = frontierSize * BOTTOM_UP_FACTOR > unvisitedCount || (bottomUp && frontierSize * TOP_DOWN_FACTOR >= openCount);
+
+	if (useBottomUp && !bottomUp)
+		FillFrontierBits();
+	else if (!useBottomUp && bottomUp)
+		FillFrontierList();
+
+	bottomUp = useBottomUp;
+
+	if (bottomUp) {
+		ExpandBottomUp();
+		bottomUpLayerCount++;
+	}
+	else {
+		ExpandTopDown();
+	}
+
+	layer++;
+	unvisitedCount -= frontierSize;
+
+	if (endCell != Utils::INVALID_CELL && parents[endCell] != UNVISITED) {
+		BuildPath();
+		searching = false;
+		return false;
+	}
+
+	return true;
+}
+
+bool ParallelBreadthFirstSolver::Solve(Utils::CellIndex startCell, Utils::CellIndex endCell)
+{
+	Start(startCell, endCell);
+	while (ParallelBreadthFirstSolver::Step()); // Qualified, so the loop doesn't go through the vtable
+	return pathFound;
+}
+
+void ParallelBreadthFirstSolver::ComputeDistances(Utils::CellIndex startCell, std::vector<int>& distances)
+{
+	distances.assign(maze.GetCellCount(), -1);
+	this->distances = &distances;
+
+	Start(startCell, Utils::INVALID_CELL);
+	while (ParallelBreadthFirstSolver::Step());
+
+	this->distances = nullptr;
+}
+
+Utils::CellIndex ParallelBreadthFirstSolver::GetParentCell(Utils::CellIndex cell) const
+{
+	const int width = maze.GetWidth();
+	const int offsets[4] = { -width, width, -1, 1 }; // Same order as Utils::GetDirection
+
+	int parent = parents.empty() ? UNVISITED : parents[cell] & PARENT_MASK;
+
+	if (parent == UNVISITED || parent == ROOT_PARENT)
+		return Utils::INVALID_CELL;
+
+	return cell - offsets[parent - 1];
+}
+
+Utils::SearchSide ParallelBreadthFirstSolver::GetVisitedSide(Utils::CellIndex cell) const
+{
+	if (parents.empty() || parents[cell] == UNVISITED)
+		return Utils::SearchSide::None;
+	return Utils::SearchSide::Start;
+}
+
+void ParallelBreadthFirstSolver::GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& /* endFrontier */) const
+{
+	if (!bottomUp) {
+		startFrontier.insert(startFrontier.end(), frontier.begin(), frontier.end());
+		return;
+	}
+
+	for (size_t word = 0; word < frontierBits.size(); ++word) {
+		for (uint64_t bits = frontierBits[word]; bits != 0; bits &= bits - 1)
+			startFrontier.push_back((Utils::CellIndex)(word * 64 + std::countr_zero(bits)));
+	}
+}
+
+/*
+PURPOSE: Workers claim the unvisited open neighbors of their frontier blocks.
+	A claimed cell goes to the list of the worker which changed it from unvisited,
+	other frontier cells of the same layer still replace its parent if theirs is lower, so the parent doesn't depend on timing.
+*/
+void ParallelBreadthFirstSolver::ExpandTopDown()
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+	const int nextTag = (layer + 1) % 3;
+	const int nextDistance = layer + 1;
+
+	for (auto& claimed : workerFrontiers)
+		claimed.clear();
+
+	size_t blockCount = (frontier.size() + TOP_DOWN_BLOCK_SIZE - 1) / TOP_DOWN_BLOCK_SIZE;
+	const bool concurrent = threadCount > 1 && blockCount > 1; // Atomics only when another thread may claim the same cell
+
+	RunOnBlocks(blockCount, [&](size_t block, int worker) {
+		std::vector<Utils::CellIndex>& claimed = workerFrontiers[worker];
+		size_t end = std::min((block + 1) * TOP_DOWN_BLOCK_SIZE, frontier.size());
+
+		for (size_t i = block * TOP_DOWN_BLOCK_SIZE; i < end; ++i) {
+			Utils::CellIndex cell = frontier[i];
+			const int x = cell % width;
+
+			/* Same order as Utils::GetDirection */
+			const Utils::CellIndex neighbors[4] = {
+				cell >= width ? cell - width : Utils::INVALID_CELL,
+				cell + width < cellCount ? cell + width : Utils::INVALID_CELL,
+				x > 0 ? cell - 1 : Utils::INVALID_CELL,
+				x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+			};
+
+			for (int direction = 0; direction < 4; ++direction) {
+				Utils::CellIndex neighbor = neighbors[direction];
+
+				if (neighbor == Utils::INVALID_CELL || maze.IsWall(neighbor))
+					continue;
+
+				const uint8_t claim = (uint8_t)((direction + 1) | (nextTag << LAYER_SHIFT));
+				const uint64_t bit = (uint64_t)1 << (neighbor % 64);
+
+				if (!concurrent) {
+					uint8_t current = parents[neighbor];
+
+					if (current == UNVISITED) {
+						parents[neighbor] = claim;
+						claimed.push_back(neighbor);
+						unvisitedBits[neighbor / 64] &= ~bit;
+
+						if (distances)
+							(*distances)[neighbor] = nextDistance;
+					}
+					else if ((current >> LAYER_SHIFT) == nextTag && (current & PARENT_MASK) > (claim & PARENT_MASK)) {
+						parents[neighbor] = claim;
+					}
+					continue;
+				}
+
+				std::atomic_ref<uint8_t> parent(parents[neighbor]);
+				uint8_t current = parent.load(std::memory_order_relaxed);
+
+				while (true) {
+					if (current == UNVISITED) {
+						if (!parent.compare_exchange_weak(current, claim, std::memory_order_relaxed))
+							continue;
+
+						claimed.push_back(neighbor);
+						std::atomic_ref<uint64_t>(unvisitedBits[neighbor / 64]).fetch_and(~bit, std::memory_order_relaxed);
+
+						if (distances)
+							(*distances)[neighbor] = nextDistance;
+						break;
+					}
+
+					/* Visited by an earlier layer, or claimed with a lower parent */
+					if ((current >> LAYER_SHIFT) != nextTag || (current & PARENT_MASK) <= (claim & PARENT_MASK))
+						break;
+
+					if (parent.compare_exchange_weak(current, claim, std::memory_order_relaxed))
+						break;
+				}
+			}
+		}
+	});
+
+	frontier.clear();
+	for (auto& claimed : workerFrontiers)
+		frontier.insert(frontier.end(), claimed.begin(), claimed.end());
+
+	frontierSize = frontier.size();
+}
+
+/*
+PURPOSE: Every unvisited open cell of a block takes the first neighbor it finds in the frontier bitset as its parent.
+	Neighbors are tried in the order of increasing parent byte, the same parent top down ends with.
+*/
+void ParallelBreadthFirstSolver::ExpandBottomUp()
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+	const int nextTag = (layer + 1) % 3;
+	const int nextDistance = layer + 1;
+	const size_t wordCount = unvisitedBits.size();
+
+	auto IsInFrontier = [&](Utils::CellIndex cell) {
+		return ((frontierBits[cell / 64] >> (cell % 64)) & 1) != 0;
+	};
+
+	size_t blockCount = (wordCount + BOTTOM_UP_BLOCK_SIZE - 1) / BOTTOM_UP_BLOCK_SIZE;
+	blockCounts.assign(blockCount, 0);
+
+	RunOnBlocks(blockCount, [&](size_t block, int /* worker */) {
+		size_t wordEnd = std::min((block + 1) * BOTTOM_UP_BLOCK_SIZE, wordCount);
+		size_t count = 0;
+
+		for (size_t word = block * BOTTOM_UP_BLOCK_SIZE; word < wordEnd; ++word) {
+			uint64_t nextBits = 0;
+
+			for (uint64_t bits = unvisitedBits[word]; bits != 0; bits &= bits - 1) {
+				const int bit = std::countr_zero(bits);
+				const Utils::CellIndex cell = (Utils::CellIndex)(word * 64 + bit);
+				const int x = cell % width;
+
+				/* Parent below means the cell was entered upwards, which is direction 0 */
+				int direction = -1;
+
+				if (cell + width < cellCount && IsInFrontier(cell + width))
+					direction = 0;
+				else if (cell >= width && IsInFrontier(cell - width))
+					direction = 1;
+				else if (x + 1 < width && IsInFrontier(cell + 1))
+					direction = 2;
+				else if (x > 0 && IsInFrontier(cell - 1))
+					direction = 3;
+
+				if (direction < 0)
+					continue;
+
+				parents[cell] = (uint8_t)((direction + 1) | (nextTag << LAYER_SHIFT));
+				nextBits |= (uint64_t)1 << bit;
+
+				if (distances)
+					(*distances)[cell] = nextDistance;
+			}
+
+			nextFrontierBits[word] = nextBits;
+			unvisitedBits[word] &= ~nextBits;
+			count += std::popcount(nextBits);
+		}
+
+		blockCounts[block] = count;
+	});
+
+	std::swap(frontierBits, nextFrontierBits);
+
+	frontierSize = 0;
+	for (size_t count : blockCounts)
+		frontierSize += count;
+}
+
+void ParallelBreadthFirstSolver::FillFrontierBits()
+{
+	const size_t wordCount = unvisitedBits.size();
+
+	frontierBits.assign(wordCount, 0);
+	nextFrontierBits.resize(wordCount);
+
+	size_t blockCount = (frontier.size() + TOP_DOWN_BLOCK_SIZE - 1) / TOP_DOWN_BLOCK_SIZE;
+
+	RunOnBlocks(blockCount, [&](size_t block, int /* worker */) {
+		size_t end = std::min((block + 1) * TOP_DOWN_BLOCK_SIZE, frontier.size());
+
+		for (size_t i = block * TOP_DOWN_BLOCK_SIZE; i < end; ++i) {
+			Utils::CellIndex cell = frontier[i];
+			std::atomic_ref<uint64_t>(frontierBits[cell / 64]).fetch_or((uint64_t)1 << (cell % 64), std::memory_order_relaxed);
+		}
+	});
+}
+
+void ParallelBreadthFirstSolver::FillFrontierList()
+{
+	const size_t wordCount = frontierBits.size();
+
+	for (auto& claimed : workerFrontiers)
+		claimed.clear();
+
+	size_t blockCount = (wordCount + BOTTOM_UP_BLOCK_SIZE - 1) / BOTTOM_UP_BLOCK_SIZE;
+
+	RunOnBlocks(blockCount, [&](size_t block, int worker) {
+		std::vector<Utils::CellIndex>& claimed = workerFrontiers[worker];
+		size_t wordEnd = std::min((block + 1) * BOTTOM_UP_BLOCK_SIZE, wordCount);
+
+		for (size_t word = block * BOTTOM_UP_BLOCK_SIZE; word < wordEnd; ++word) {
+			for (uint64_t bits = frontierBits[word]; bits != 0; bits &= bits - 1)
+				claimed.push_back((Utils::CellIndex)(word * 64 + std::countr_zero(bits)));
+		}
+	});
+
+	frontier.clear();
+	for (auto& claimed : workerFrontiers)
+		frontier.insert(frontier.end(), claimed.begin(), claimed.end());
+}
+
+/*
+PURPOSE: Walks the entered directions back from the end cell, then reverses the cells so the path starts from the start cell
+*/
+void ParallelBreadthFirstSolver::BuildPath()
+{
+	path.clear();
+	TraceParents(parents, maze.GetWidth(), endCell, path);
+
+	std::reverse(path.begin(), path.end());
+	pathFound = true;
+}
+
+void ParallelBreadthFirstSolver::RunOnBlocks(size_t blockCount, const std::function<void(size_t, int)>& function)
+{
+	std::atomic<size_t> nextBlock{ 0 };
+
+	auto worker = [&](int workerIndex) {
+		for (size_t block = nextBlock++; block < blockCount; block = nextBlock++)
+			function(block, workerIndex);
+	};
+
+	size_t workerCount = (size_t)threadCount < blockCount ? (size_t)threadCount : blockCount;
+
+	std::vector<std::thread> workers;
+
+	for (size_t i = 1; i < workerCount; ++i)
+		workers.emplace_back(worker, (int)i);
+
+	worker(0); // The calling thread works too
+
+	for (auto& thread : workers)
+		thread.join();
+}
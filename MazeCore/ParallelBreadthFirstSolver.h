@@ -0,0 +1,108 @@
+#pragma once
+
+/*
+
+ParallelBreadthFirstSolver class, a level synchronous breadth first search for huge mazes.
+Every step expands one whole distance layer on the worker threads and switches between two ways of doing it:
+Top down, workers take blocks of the frontier and claim the unvisited neighbors of its cells with an atomic compare and swap on their parent byte,
+each worker collects the cells it claimed in its own list, and the lists become the next frontier.
+Bottom up, used while the frontier is a large share of the unvisited cells, workers take blocks of the unvisited cell bitset
+and every unvisited cell looks for a neighbor in the frontier bitset, so no cell is written by two threads.
+
+When two frontier cells reach the same cell the lowest parent byte wins in both ways,
+so parents, distances and the path don't depend on the thread count or on the switching.
+Small layers run on the calling thread only, threads are started only for layers with more than one block.
+
+*/
+
+#include "StepSolver.h"
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+class Maze;
+
+class ParallelBreadthFirstSolver final : public StepSolver
+{
+public:
+	ParallelBreadthFirstSolver() = delete;
+	ParallelBreadthFirstSolver(const Maze& maze, int threadCount);
+
+	ParallelBreadthFirstSolver(const ParallelBreadthFirstSolver& other) = delete;
+	ParallelBreadthFirstSolver& operator=(const ParallelBreadthFirstSolver& other) = delete;
+
+	void Start(Utils::CellIndex startCell, Utils::CellIndex endCell) override; // End cell may be Utils::INVALID_CELL to visit every reachable cell
+	bool Step() override; // Expands one distance layer
+	bool Solve(Utils::CellIndex startCell, Utils::CellIndex endCell) override;
+
+	/* Visits every cell reachable from <startCell>, unreachable cells get -1 */
+	void ComputeDistances(Utils::CellIndex startCell, std::vector<int>& distances);
+
+	bool IsPathFound() const override { return pathFound; }
+	const std::vector<Utils::CellIndex>& GetPath() const override { return path; }
+
+	uint64_t GetExpandedCount() const override { return expandedCount; }
+	int GetLayerCount() const { return layer; }
+	int GetBottomUpLayerCount() const { return bottomUpLayerCount; }
+
+	Utils::CellIndex GetParentCell(Utils::CellIndex cell) const; // Utils::INVALID_CELL for the start cell and unvisited cells
+
+	Utils::CellIndex GetHeadCell() const override { return Utils::INVALID_CELL; } // A whole layer is expanded at once
+	Utils::SearchSide GetVisitedSide(Utils::CellIndex cell) const override;
+	void GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& endFrontier) const override;
+
+private:
+	void ExpandTopDown();
+	void ExpandBottomUp();
+	void FillFrontierBits();
+	void FillFrontierList();
+
+	void BuildPath();
+
+	/* Runs <function(block, worker)> for every block, on the calling thread only if there is one block */
+	void RunOnBlocks(size_t blockCount, const std::function<void(size_t, int)>& function);
+
+private:
+	/* Parent bytes also keep the layer of the claim modulo 3, a cell next to the frontier is one layer away at most, so it tells the cells claimed by this layer apart */
+	static constexpr int LAYER_SHIFT = 3;
+
+	static constexpr size_t TOP_DOWN_BLOCK_SIZE = 1 << 13; // Frontier cells
+	static constexpr size_t BOTTOM_UP_BLOCK_SIZE = 1 << 12; // Bitset words
+
+	/* Bottom up starts when the frontier is more than 1 / BOTTOM_UP_FACTOR of the unvisited cells, top down returns below 1 / TOP_DOWN_FACTOR of the open cells */
+	static constexpr size_t BOTTOM_UP_FACTOR = 14;
+	static constexpr size_t TOP_DOWN_FACTOR = 24;
+
+	const Maze& maze;
+	int threadCount = 1;
+
+	std::vector<uint8_t> parents;
+	std::vector<int>* distances = nullptr; // Only set by ComputeDistances
+
+	/* Top down frontier and the cells each worker claimed for the next one */
+	std::vector<Utils::CellIndex> frontier;
+	std::vector<std::vector<Utils::CellIndex>> workerFrontiers;
+
+	/* Bottom up state, one bit per cell */
+	std::vector<uint64_t> frontierBits;
+	std::vector<uint64_t> nextFrontierBits;
+	std::vector<uint64_t> unvisitedBits;
+	std::vector<size_t> blockCounts;
+
+	bool bottomUp = false;
+	size_t frontierSize = 0;
+	size_t openCount = 0;
+	size_t unvisitedCount = 0;
+
+	Utils::CellIndex startCell = Utils::INVALID_CELL;
+	Utils::CellIndex endCell = Utils::INVALID_CELL;
+
+	bool searching = false;
+	bool pathFound = false;
+	std::vector<Utils::CellIndex> path;
+
+	uint64_t expandedCount = 0;
+	int layer = 0;
+	int bottomUpLayerCount = 0;
+};
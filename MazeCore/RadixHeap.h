@@ -0,0 +1,96 @@
+#pragma once
+
+/*
+
+RadixHeap class, a monotone priority queue of cells with 32 bit keys used by the Dijkstra solver.
+Popped keys never decrease and pushed keys are never smaller than the last popped key, which is always true for Dijkstra.
+Bucket i holds the entries whose key first differs from the last popped key at bit i - 1, bucket 0 holds the keys equal to it.
+When bucket 0 is empty, the smallest key of the first non-empty bucket becomes the last key and that bucket is spread
+over the lower buckets. An entry only moves to lower buckets, so it moves at most 32 times and pops are O(1) amortized
+with sequential memory access, unlike the log n scattered swaps of a binary heap.
+
+*/
+
+#include "Utils.h"
+
+#include <vector>
+#include <cstdint>
+#include <bit>
+
+class RadixHeap
+{
+public:
+	struct Entry
+	{
+		uint32_t key;
+		Utils::CellIndex cell;
+	};
+
+public:
+	void Clear() {
+		for (auto& bucket : buckets)
+			bucket.clear();
+
+		size = 0;
+		lastKey = 0;
+	}
+
+	bool IsEmpty() const { return size == 0; }
+	size_t GetSize() const { return size; }
+
+	/* <key> must not be smaller than the last popped key */
+	void Push(uint32_t key, Utils::CellIndex cell) {
+		buckets[GetBucket(key)].push_back({ key, cell });
+		size++;
+	}
+
+	/* Any entry with the smallest key, the heap must not be empty */
+	Entry Pop() {
+		if (buckets[0].empty())
+			Redistribute();
+
+		Entry entry = buckets[0].back();
+		buckets[0].pop_back();
+		size--;
+
+		return entry;
+	}
+
+	template <typename Function>
+	void ForEach(Function function) const {
+		for (const auto& bucket : buckets) {
+			for (const auto& entry : bucket)
+				function(entry);
+		}
+	}
+
+private:
+	int GetBucket(uint32_t key) const { return std::bit_width(key ^ lastKey); }
+
+	void Redistribute() {
+		int index = 1;
+		while (buckets[index].empty())
+			index++;
+
+		std::vector<Entry>& bucket = buckets[index];
+
+		uint32_t minKey = bucket[0].key;
+		for (const auto& entry : bucket)
+			minKey = entry.key < minKey ? entry.key : minKey;
+
+		lastKey = minKey;
+
+		/* Every entry shares more leading bits with the new last key, so it goes to a lower bucket */
+		for (const auto& entry : bucket)
+			buckets[GetBucket(entry.key)].push_back(entry);
+
+		bucket.clear();
+	}
+
+private:
+	static constexpr int BUCKET_COUNT = 33;
+
+	std::vector<Entry> buckets[BUCKET_COUNT];
+	size_t size = 0;
+	uint32_t lastKey = 0;
+};
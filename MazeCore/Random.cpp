@@ -0,0 +1,63 @@
+#include "Random.h"
+
+#include <random>
+#include <chrono>
+
+/*
+PURPOSE: Expands a 64 bit seed into the 256 bit state with splitmix64, as recommended by the xoshiro authors.
+	The state can never be all zeros this way.
+*/
+void Random::Seed(uint64_t seed)
+{
+	for (int i = 0; i < 4; ++i) {
+		seed += 0x9E3779B97F4A7C15ull;
+
+		uint64_t z = seed;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+
+		state[i] = z ^ (z >> 31);
+	}
+}
+
+void Random::Jump()
+{
+	static const uint64_t jumpTable[4] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+
+	ApplyJump(jumpTable);
+}
+
+void Random::LongJump()
+{
+	static const uint64_t longJumpTable[4] = { 0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull };
+
+	ApplyJump(longJumpTable);
+}
+
+uint64_t Random::GenerateRandomSeed()
+{
+	std::random_device device;
+
+	uint64_t seed = ((uint64_t)device() << 32) ^ device();
+	seed ^= (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+
+	return seed;
+}
+
+void Random::ApplyJump(const uint64_t (&jumpTable)[4])
+{
+	uint64_t jumped[4] = { 0, 0, 0, 0 };
+
+	for (int i = 0; i < 4; ++i) {
+		for (int bit = 0; bit < 64; ++bit) {
+			if (jumpTable[i] & (1ull << bit)) {
+				for (int j = 0; j < 4; ++j)
+					jumped[j] ^= state[j];
+			}
+			Next();
+		}
+	}
+
+	for (int j = 0; j < 4; ++j)
+		state[j] = jumped[j];
+}
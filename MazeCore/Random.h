@@ -0,0 +1,77 @@
+#pragma once
+
+/*
+
+Random class, a xoshiro256** pseudo random number generator owned by each maze.
+It gives the same sequence for the same seed on every platform and it supports jumping ahead,
+so independent streams can be derived from one seed without sharing any global state.
+
+*/
+
+#include <cstdint>
+
+class Random
+{
+public:
+	Random() { Seed(0); }
+	explicit Random(uint64_t seed) { Seed(seed); }
+
+	void Seed(uint64_t seed);
+
+	/* Next 64 random bits */
+	uint64_t Next() {
+		const uint64_t result = RotateLeft(state[1] * 5, 7) * 9;
+		const uint64_t t = state[1] << 17;
+
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+
+		state[2] ^= t;
+		state[3] = RotateLeft(state[3], 45);
+
+		return result;
+	}
+
+	/* Uniform integer in [0, bound), bound must be positive */
+	int NextInt(int bound) {
+		/* Lemire's multiply and reject method, it avoids the modulo bias of rand() % bound */
+		uint64_t product = (Next() >> 32) * (uint64_t)bound;
+		uint32_t low = (uint32_t)product;
+
+		if (low < (uint32_t)bound) {
+			uint32_t threshold = (uint32_t)(-(uint32_t)bound) % (uint32_t)bound;
+
+			while (low < threshold) {
+				product = (Next() >> 32) * (uint64_t)bound;
+				low = (uint32_t)product;
+			}
+		}
+
+		return (int)(product >> 32);
+	}
+
+	/* Uniform float in [0, 1) */
+	float NextFloat() { return (float)(Next() >> 40) * (1.0f / 16777216.0f); }
+
+	void Jump();     // Advances the state by 2^128 steps
+	void LongJump(); // Advances the state by 2^192 steps
+
+	/* Returns a generator for the current stream and moves this one 2^128 steps ahead, so both never overlap */
+	Random Split() {
+		Random child = *this;
+		Jump();
+		return child;
+	}
+
+	static uint64_t GenerateRandomSeed(); // Non deterministic seed from the system
+
+private:
+	static uint64_t RotateLeft(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+	void ApplyJump(const uint64_t (&jumpTable)[4]);
+
+private:
+	uint64_t state[4];
+};
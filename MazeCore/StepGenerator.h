@@ -0,0 +1,22 @@
+#pragma once
+
+/*
+
+StepGenerator interface for the generation algorithms which are advanced one step at a time by Maze::UpdateGeneration,
+so the visualizer can show them like the default depth first search.
+
+*/
+
+#include "Utils.h"
+#include "Random.h"
+
+class StepGenerator
+{
+public:
+	virtual ~StepGenerator() = default;
+
+	virtual void Start(Random& random) = 0; // The grid must be all walls
+	virtual bool Step(Random& random) = 0;  // Returns false when the generation is complete
+
+	virtual Utils::CellIndex GetHeadCell() const = 0; // Cell changed by the last step, shown by renderers
+};
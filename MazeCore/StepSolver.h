@@ -0,0 +1,64 @@
+#pragma once
+
+/*
+
+StepSolver interface for the solving algorithms which find the whole path in one search.
+They can be advanced one step at a time by Maze::UpdateSolving so the visualizer can show the search,
+or run to the end with Solve(). Solvers only read the maze, so one solver can be reused for many queries.
+
+*/
+
+#include "Utils.h"
+
+#include <vector>
+#include <cstdint>
+
+class StepSolver
+{
+public:
+	virtual ~StepSolver() = default;
+
+	virtual void Start(Utils::CellIndex startCell, Utils::CellIndex endCell) = 0;
+	virtual bool Step() = 0; // Returns false when the search is over
+
+	/* Runs the whole search, returns true if a path is found */
+	virtual bool Solve(Utils::CellIndex startCell, Utils::CellIndex endCell) {
+		Start(startCell, endCell);
+		while (Step());
+		return IsPathFound();
+	}
+
+	virtual bool IsPathFound() const = 0;
+	virtual const std::vector<Utils::CellIndex>& GetPath() const = 0; // From the start cell to the end cell, both included
+
+	virtual uint64_t GetExpandedCount() const = 0; // Cells taken out of the frontier by the last search
+
+	/* State used by renderers */
+	virtual Utils::CellIndex GetHeadCell() const = 0; // Cell expanded by the last step
+	virtual Utils::SearchSide GetVisitedSide(Utils::CellIndex cell) const = 0;
+	virtual void GetFrontier(std::vector<Utils::CellIndex>& startFrontier, std::vector<Utils::CellIndex>& endFrontier) const = 0; // Appends the open cells, one sided searches only use <startFrontier>
+
+protected:
+	/*
+	Searches keep one parent byte per cell, its low bits hold the direction the cell was entered from as <direction index> + 1,
+	ROOT_PARENT marks the cell the search started from and the high bits are free for flags of each solver.
+	*/
+	static constexpr uint8_t UNVISITED = 0;
+	static constexpr uint8_t ROOT_PARENT = 5;
+	static constexpr uint8_t PARENT_MASK = 0x7;
+
+	/* Appends the cells from <cell> back to the root of the search, both included */
+	static void TraceParents(const std::vector<uint8_t>& parents, int width, Utils::CellIndex cell, std::vector<Utils::CellIndex>& cells) {
+		const int offsets[4] = { -width, width, -1, 1 }; // Same order as Utils::GetDirection
+
+		while (true) {
+			cells.push_back(cell);
+
+			int parent = parents[cell] & PARENT_MASK;
+			if (parent == ROOT_PARENT)
+				break;
+
+			cell -= offsets[parent - 1];
+		}
+	}
+};
@@ -0,0 +1,181 @@
+#include "TiledGenerator.h"
+#include "Maze.h"
+
+#include <thread>
+#include <atomic>
+
+TiledGenerator::TiledGenerator(Maze& maze, int tileSize, int threadCount) : maze(maze), tileSize(tileSize), threadCount(threadCount)
+{
+	/* Tile positions are packed into 16 bits while carving */
+	if (this->tileSize < 1)
+		this->tileSize = 1;
+	if (this->tileSize > MAX_TILE_SIZE)
+		this->tileSize = MAX_TILE_SIZE;
+
+	/* 0 uses all cores like the solvers, hardware_concurrency() may also give 0 if it can't tell */
+	if (this->threadCount < 1)
+		this->threadCount = (int)std::thread::hardware_concurrency();
+	if (this->threadCount < 1)
+		this->threadCount = 1;
+
+	latticeWidth = (maze.GetWidth() - 1) / 2;
+	latticeHeight = (maze.GetHeight() - 1) / 2;
+
+	tilesX = (latticeWidth + this->tileSize - 1) / this->tileSize;
+	tilesY = (latticeHeight + this->tileSize - 1) / this->tileSize;
+}
+
+void TiledGenerator::Generate(Random& random)
+{
+	const int tileCount = tilesX * tilesY;
+
+	if (tileCount == 0)
+		return;
+
+	/* Streams are derived in tile order before any thread starts, so they don't depend on scheduling */
+	std::vector<Random> tileRandoms;
+	tileRandoms.reserve(tileCount);
+
+	for (int i = 0; i < tileCount; ++i)
+		tileRandoms.push_back(random.Split());
+
+	/* Tiles only write to their own cells, workers pick the next tile from a shared counter */
+	std::atomic<int> nextTile{ 0 };
+
+	auto worker = [&]() {
+		std::vector<uint32_t> stack;
+
+		for (int tile = nextTile++; tile < tileCount; tile = nextTile++)
+			CarveTile(tile, tileRandoms[tile], stack);
+	};
+
+	int workerCount = threadCount < tileCount ? threadCount : tileCount;
+
+	std::vector<std::thread> workers;
+
+	for (int i = 1; i < workerCount; ++i)
+		workers.emplace_back(worker);
+
+	worker(); // The calling thread works too
+
+	for (auto& thread : workers)
+		thread.join();
+
+	StitchTiles(random);
+}
+
+/*
+PURPOSE: Carves a single tile with an iterative randomized depth first search that never leaves the tile.
+	The stack holds lattice positions relative to the tile packed into 16 bit halves, so no division is needed per step.
+*/
+void TiledGenerator::CarveTile(int tileIndex, Random& random, std::vector<uint32_t>& stack)
+{
+	const int x0 = (tileIndex % tilesX) * tileSize;
+	const int y0 = (tileIndex / tilesX) * tileSize;
+	const int tileWidth = (x0 + tileSize < latticeWidth ? x0 + tileSize : latticeWidth) - x0;
+	const int tileHeight = (y0 + tileSize < latticeHeight ? y0 + tileSize : latticeHeight) - y0;
+
+	const int rowStride = 2 * maze.GetWidth(); // Cells between two lattice rows
+	const Utils::CellIndex tileOrigin = GetLatticeCell(x0, y0);
+
+	stack.clear();
+
+	int startX = random.NextInt(tileWidth);
+	int startY = random.NextInt(tileHeight);
+
+	maze.SetWall(tileOrigin + startY * rowStride + startX * 2, false);
+	stack.push_back((uint32_t)startY << 16 | (uint32_t)startX);
+
+	while (!stack.empty()) {
+		int localX = stack.back() & 0xFFFF;
+		int localY = stack.back() >> 16;
+
+		Utils::CellIndex currentCell = tileOrigin + localY * rowStride + localX * 2;
+
+		/* Find unvisited neighbors inside the tile, lattice neighbors are two cells away */
+		uint32_t unvisitedNeighbors[4];
+		int unvisitedNeighborCount = 0;
+
+		if (localY > 0 && maze.IsWall(currentCell - rowStride)) unvisitedNeighbors[unvisitedNeighborCount++] = (uint32_t)(localY - 1) << 16 | (uint32_t)localX;
+		if (localY < tileHeight - 1 && maze.IsWall(currentCell + rowStride)) unvisitedNeighbors[unvisitedNeighborCount++] = (uint32_t)(localY + 1) << 16 | (uint32_t)localX;
+		if (localX > 0 && maze.IsWall(currentCell - 2)) unvisitedNeighbors[unvisitedNeighborCount++] = (uint32_t)localY << 16 | (uint32_t)(localX - 1);
+		if (localX < tileWidth - 1 && maze.IsWall(currentCell + 2)) unvisitedNeighbors[unvisitedNeighborCount++] = (uint32_t)localY << 16 | (uint32_t)(localX + 1);
+
+		if (unvisitedNeighborCount == 0) {
+			stack.pop_back();
+			continue;
+		}
+
+		uint32_t selectedNeighbor = unvisitedNeighbors[random.NextInt(unvisitedNeighborCount)];
+		Utils::CellIndex neighborCell = tileOrigin + (int)(selectedNeighbor >> 16) * rowStride + (int)(selectedNeighbor & 0xFFFF) * 2;
+
+		maze.SetWall((currentCell + neighborCell) / 2, false); // Wall between them is the midpoint
+		maze.SetWall(neighborCell, false);
+		stack.push_back(selectedNeighbor);
+	}
+}
+
+/*
+PURPOSE: Joins the tiles along a random spanning tree of the tile grid with one passage per tree edge
+*/
+void TiledGenerator::StitchTiles(Random& random)
+{
+	const int tileCount = tilesX * tilesY;
+
+	std::vector<bool> visitedTiles(tileCount, false);
+	std::vector<int> tileStack;
+
+	int startTile = random.NextInt(tileCount);
+	visitedTiles[startTile] = true;
+	tileStack.push_back(startTile);
+
+	while (!tileStack.empty()) {
+		int currentTile = tileStack.back();
+
+		int tileX = currentTile % tilesX;
+		int tileY = currentTile / tilesX;
+
+		int unvisitedTiles[4];
+		int unvisitedTileCount = 0;
+
+		if (tileY > 0 && !visitedTiles[currentTile - tilesX]) unvisitedTiles[unvisitedTileCount++] = currentTile - tilesX;
+		if (tileY < tilesY - 1 && !visitedTiles[currentTile + tilesX]) unvisitedTiles[unvisitedTileCount++] = currentTile + tilesX;
+		if (tileX > 0 && !visitedTiles[currentTile - 1]) unvisitedTiles[unvisitedTileCount++] = currentTile - 1;
+		if (tileX < tilesX - 1 && !visitedTiles[currentTile + 1]) unvisitedTiles[unvisitedTileCount++] = currentTile + 1;
+
+		if (unvisitedTileCount == 0) {
+			tileStack.pop_back();
+			continue;
+		}
+
+		int selectedTile = unvisitedTiles[random.NextInt(unvisitedTileCount)];
+
+		/* Open a random passage on the shared border, counted from the tile with the smaller index */
+		int firstTile = currentTile < selectedTile ? currentTile : selectedTile;
+		int firstX = (firstTile % tilesX) * tileSize;
+		int firstY = (firstTile / tilesX) * tileSize;
+
+		if (selectedTile / tilesX == tileY) {
+			/* Horizontal neighbors on the same tile row (stacked tiles also differ by 1 if the grid is one tile wide), the border is the last lattice column of the first tile */
+			int rowCount = (firstY + tileSize < latticeHeight ? firstY + tileSize : latticeHeight) - firstY;
+			Utils::CellIndex borderCell = GetLatticeCell(firstX + tileSize - 1, firstY + random.NextInt(rowCount));
+
+			maze.SetWall(borderCell + 1, false);
+		}
+		else {
+			/* Vertical neighbors, the border is the last lattice row of the first tile */
+			int columnCount = (firstX + tileSize < latticeWidth ? firstX + tileSize : latticeWidth) - firstX;
+			Utils::CellIndex borderCell = GetLatticeCell(firstX + random.NextInt(columnCount), firstY + tileSize - 1);
+
+			maze.SetWall(borderCell + maze.GetWidth(), false);
+		}
+
+		visitedTiles[selectedTile] = true;
+		tileStack.push_back(selectedTile);
+	}
+}
+
+Utils::CellIndex TiledGenerator::GetLatticeCell(int latticeX, int latticeY) const
+{
+	return (2 * latticeY + 1) * maze.GetWidth() + 2 * latticeX + 1;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+
+TiledGenerator class that generates a perfect maze on all cores with a divide and conquer approach.
+The odd cell lattice is split into square tiles, each tile is carved independently by a randomized depth first search
+on a worker thread, then the tiles are joined by opening a single border passage along each edge of a random spanning tree of tiles.
+A spanning tree of spanning trees stays a spanning tree, so the result is still a perfect maze.
+
+Each tile draws from its own random stream which only depends on the seed and the tile index,
+so the maze is the same for a given seed and tile size whatever the thread count is.
+
+*/
+
+#include "Utils.h"
+#include "Random.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class TiledGenerator
+{
+public:
+	TiledGenerator() = delete;
+	TiledGenerator(Maze& maze, int tileSize, int threadCount);
+
+	TiledGenerator(const TiledGenerator& other) = delete;
+	TiledGenerator& operator=(const TiledGenerator& other) = delete;
+
+	void Generate(Random& random); // Carves the whole maze, the grid must be all walls
+
+private:
+	void CarveTile(int tileIndex, Random& random, std::vector<uint32_t>& stack);
+	void StitchTiles(Random& random);
+
+	/* Helpers */
+	Utils::CellIndex GetLatticeCell(int latticeX, int latticeY) const;
+
+private:
+	static constexpr int MAX_TILE_SIZE = 1 << 16;
+
+	Maze& maze;
+
+	int tileSize;    // Tile edge length in lattice cells
+	int threadCount;
+
+	int latticeWidth;  // Odd cells on a row
+	int latticeHeight; // Odd cells on a column
+
+	int tilesX;
+	int tilesY;
+};
@@ -0,0 +1,252 @@
+#include "TreePathOracle.h"
+#include "Maze.h"
+
+#include <algorithm>
+
+TreePathOracle::TreePathOracle(const Maze& maze) : maze(maze)
+{
+}
+
+/*
+PURPOSE: Roots the tree at the first open cell with an iterative depth first search and records the Euler tour.
+	Meeting a visited cell which is not the parent means a loop, cells the search doesn't reach mean more than one tree.
+*/
+bool TreePathOracle::Build()
+{
+	const int width = maze.GetWidth();
+	const int cellCount = maze.GetCellCount();
+	const int offsets[4] = { -width, width, -1, 1 }; // Same order as Utils::GetDirection
+
+	isTree = false;
+
+	parents.assign(cellCount, UNVISITED);
+	depths.assign(cellCount, -1);
+	firstVisits.assign(cellCount, -1);
+	tourCells.clear();
+	tourDepths.clear();
+
+	Utils::CellIndex root = 0;
+	while (root < cellCount && maze.IsWall(root))
+		root++;
+
+	if (root == cellCount)
+		return false;
+
+	bool hasLoop = false;
+	int openCount = 0;
+
+	for (Utils::CellIndex cell = 0; cell < cellCount; ++cell)
+		openCount += maze.IsWall(cell) ? 0 : 1;
+
+	tourCells.reserve(2 * (size_t)openCount);
+	tourDepths.reserve(2 * (size_t)openCount);
+
+	/* Stack of cells and the next direction to try from each */
+	std::vector<Utils::CellIndex> stack;
+	std::vector<uint8_t> nextDirections;
+
+	parents[root] = ROOT_PARENT;
+	depths[root] = 0;
+	firstVisits[root] = 0;
+	tourCells.push_back(root);
+	tourDepths.push_back(0);
+
+	stack.push_back(root);
+	nextDirections.push_back(0);
+
+	while (!stack.empty()) {
+		Utils::CellIndex cell = stack.back();
+		int direction = nextDirections.back();
+
+		if (direction == 4) {
+			stack.pop_back();
+			nextDirections.pop_back();
+
+			/* Back in the parent */
+			if (!stack.empty()) {
+				tourCells.push_back(stack.back());
+				tourDepths.push_back(depths[stack.back()]);
+			}
+			continue;
+		}
+
+		nextDirections.back()++;
+
+		const int x = cell % width;
+		bool inside = (direction == 0 && cell >= width) || (direction == 1 && cell + width < cellCount) ||
+			(direction == 2 && x > 0) || (direction == 3 && x + 1 < width);
+
+		if (!inside)
+			continue;
+
+		Utils::CellIndex neighbor = cell + offsets[direction];
+
+		if (maze.IsWall(neighbor))
+			continue;
+
+		if (parents[neighbor] != UNVISITED) {
+			if (neighbor != GetParent(cell))
+				hasLoop = true;
+			continue;
+		}
+
+		parents[neighbor] = (uint8_t)(direction + 1);
+		depths[neighbor] = depths[cell] + 1;
+		firstVisits[neighbor] = (int)tourCells.size();
+		tourCells.push_back(neighbor);
+		tourDepths.push_back(depths[neighbor]);
+
+		stack.push_back(neighbor);
+		nextDirections.push_back(0);
+	}
+
+	int visitedCount = (int)(tourCells.size() + 1) / 2;
+
+	if (hasLoop || visitedCount != openCount) {
+		std::cout << "Tree path oracle needs a perfect maze, " << (hasLoop ? "a loop was found" : "some open cells are not connected") << "\n";
+		return false;
+	}
+
+	BuildSparseTable();
+
+	isTree = true;
+	return true;
+}
+
+Utils::CellIndex TreePathOracle::GetCommonAncestor(Utils::CellIndex cell0, Utils::CellIndex cell1) const
+{
+	if (!IsQueryable(cell0) || !IsQueryable(cell1))
+		return Utils::INVALID_CELL;
+
+	int first = firstVisits[cell0];
+	int last = firstVisits[cell1];
+
+	if (first > last)
+		std::swap(first, last);
+
+	const int firstBlock = first / BLOCK_SIZE;
+	const int lastBlock = last / BLOCK_SIZE;
+
+	int best = first;
+
+	if (firstBlock == lastBlock) {
+		for (int i = first + 1; i <= last; ++i)
+			best = GetShallowerTourIndex(best, i);
+
+		return tourCells[best];
+	}
+
+	/* Partial blocks at both ends are scanned */
+	for (int i = first + 1; i < (firstBlock + 1) * BLOCK_SIZE; ++i)
+		best = GetShallowerTourIndex(best, i);
+
+	for (int i = lastBlock * BLOCK_SIZE; i <= last; ++i)
+		best = GetShallowerTourIndex(best, i);
+
+	/* Whole blocks between them from two overlapping sparse table ranges */
+	if (lastBlock - firstBlock > 1) {
+		int blockFrom = firstBlock + 1;
+		int blockCountBetween = lastBlock - blockFrom;
+
+		int level = 0;
+		while ((2 << level) <= blockCountBetween)
+			level++;
+
+		best = GetShallowerTourIndex(best, sparseTable[levelBegins[level] + blockFrom]);
+		best = GetShallowerTourIndex(best, sparseTable[levelBegins[level] + lastBlock - (1 << level)]);
+	}
+
+	return tourCells[best];
+}
+
+int TreePathOracle::GetDistance(Utils::CellIndex cell0, Utils::CellIndex cell1) const
+{
+	Utils::CellIndex ancestor = GetCommonAncestor(cell0, cell1);
+
+	if (ancestor == Utils::INVALID_CELL)
+		return -1;
+
+	return depths[cell0] + depths[cell1] - 2 * depths[ancestor];
+}
+
+/*
+PURPOSE: Walks the start cell up to the common ancestor, then appends the walk of the end cell up to it in reverse
+*/
+bool TreePathOracle::GetPath(Utils::CellIndex startCell, Utils::CellIndex endCell, std::vector<Utils::CellIndex>& path) const
+{
+	path.clear();
+
+	Utils::CellIndex ancestor = GetCommonAncestor(startCell, endCell);
+
+	if (ancestor == Utils::INVALID_CELL)
+		return false;
+
+	for (Utils::CellIndex cell = startCell; cell != ancestor; cell = GetParent(cell))
+		path.push_back(cell);
+
+	path.push_back(ancestor);
+
+	const size_t endSideBegin = path.size();
+
+	for (Utils::CellIndex cell = endCell; cell != ancestor; cell = GetParent(cell))
+		path.push_back(cell);
+
+	std::reverse(path.begin() + endSideBegin, path.end());
+	return true;
+}
+
+void TreePathOracle::BuildSparseTable()
+{
+	const int tourLength = (int)tourCells.size();
+
+	blockCount = (tourLength + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+	sparseTable.clear();
+	levelBegins.clear();
+
+	/* Level 0, the shallowest cell of each block */
+	levelBegins.push_back(0);
+
+	for (int block = 0; block < blockCount; ++block) {
+		int best = block * BLOCK_SIZE;
+		int blockEnd = std::min(best + BLOCK_SIZE, tourLength);
+
+		for (int i = best + 1; i < blockEnd; ++i)
+			best = GetShallowerTourIndex(best, i);
+
+		sparseTable.push_back(best);
+	}
+
+	for (int level = 1; (1 << level) <= blockCount; ++level) {
+		size_t previousBegin = levelBegins.back();
+		levelBegins.push_back(sparseTable.size());
+
+		for (int block = 0; block + (1 << level) <= blockCount; ++block) {
+			int left = sparseTable[previousBegin + block];
+			int right = sparseTable[previousBegin + block + (1 << (level - 1))];
+
+			sparseTable.push_back(GetShallowerTourIndex(left, right));
+		}
+	}
+}
+
+int TreePathOracle::GetShallowerTourIndex(int tourIndex0, int tourIndex1) const
+{
+	return tourDepths[tourIndex1] < tourDepths[tourIndex0] ? tourIndex1 : tourIndex0;
+}
+
+Utils::CellIndex TreePathOracle::GetParent(Utils::CellIndex cell) const
+{
+	const int width = maze.GetWidth();
+	const int offsets[4] = { -width, width, -1, 1 }; // Same order as Utils::GetDirection
+
+	if (parents[cell] == ROOT_PARENT || parents[cell] == UNVISITED)
+		return Utils::INVALID_CELL;
+
+	return cell - offsets[parents[cell] - 1];
+}
+
+bool TreePathOracle::IsQueryable(Utils::CellIndex cell) const
+{
+	return isTree && cell >= 0 && cell < (int)depths.size() && depths[cell] >= 0;
+}
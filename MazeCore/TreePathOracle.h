@@ -0,0 +1,68 @@
+#pragma once
+
+/*
+
+TreePathOracle class that answers path queries on perfect mazes without searching.
+The open cells of a perfect maze form a tree, so it is rooted once and the path between two cells goes through their lowest common ancestor.
+The lowest common ancestor is the shallowest cell between their first visits in the Euler tour of the tree,
+it is found with a sparse table over the minimums of fixed size blocks of the tour and a scan of at most two partial blocks.
+The sparse table only has an entry per block and level, so the index stays a few bytes per cell on huge mazes.
+
+Distance queries are O(1) (two block scans and two table reads), paths are built by walking both cells up to the common ancestor.
+
+*/
+
+#include "Utils.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class TreePathOracle
+{
+public:
+	TreePathOracle() = delete;
+	TreePathOracle(const Maze& maze);
+
+	TreePathOracle(const TreePathOracle& other) = delete;
+	TreePathOracle& operator=(const TreePathOracle& other) = delete;
+
+	bool Build(); // Returns false if the open cells are not a single tree, queries are refused then
+	bool IsTree() const { return isTree; }
+
+	Utils::CellIndex GetCommonAncestor(Utils::CellIndex cell0, Utils::CellIndex cell1) const;
+	int GetDistance(Utils::CellIndex cell0, Utils::CellIndex cell1) const; // -1 if it can't be answered
+	bool GetPath(Utils::CellIndex startCell, Utils::CellIndex endCell, std::vector<Utils::CellIndex>& path) const; // Start and end included
+
+private:
+	void BuildSparseTable();
+	int GetShallowerTourIndex(int tourIndex0, int tourIndex1) const;
+
+	Utils::CellIndex GetParent(Utils::CellIndex cell) const;
+	bool IsQueryable(Utils::CellIndex cell) const;
+
+private:
+	static constexpr int BLOCK_SIZE = 32;
+
+	static constexpr uint8_t UNVISITED = 0;
+	static constexpr uint8_t ROOT_PARENT = 5; // Other parents are the direction the cell was entered from as <direction index> + 1
+
+	const Maze& maze;
+
+	bool isTree = false;
+
+	/* Per cell */
+	std::vector<uint8_t> parents;
+	std::vector<int> depths;
+	std::vector<int> firstVisits; // First index of the cell in the tour
+
+	/* Euler tour, a cell is added when it is entered and after each of its children */
+	std::vector<Utils::CellIndex> tourCells;
+	std::vector<int> tourDepths;
+
+	/* Level k holds the tour index of the shallowest cell in blocks [b, b + 2^k) at levelBegins[k] + b */
+	std::vector<int> sparseTable;
+	std::vector<size_t> levelBegins;
+	int blockCount = 0;
+};
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <iostream>
+
+namespace Utils {
+	enum class Phase
+	{
+		Idle,
+		Generation,
+		CellSelection,
+		Solving,
+		Completed
+	};
+
+	inline Phase GetNextPhase(Phase currentPhase) {
+		return static_cast<Phase>((static_cast<int>(currentPhase) + 1) % 5);
+	}
+
+	/* How the visualizer advances the maze between frames */
+	enum class SteppingMode
+	{
+		Interval, // A single step per SIMULATION_INTERVAL
+		Turbo,    // As many steps as fit into the frame budget
+		Instant   // Phases run to the end in a single frame
+	};
+
+	inline SteppingMode GetNextSteppingMode(SteppingMode currentMode) {
+		return static_cast<SteppingMode>((static_cast<int>(currentMode) + 1) % 3);
+	}
+
+	/* Algorithms stepped by Maze::UpdateGeneration */
+	enum class GenerationAlgorithm
+	{
+		Backtracker, // Randomized depth first search, long corridors
+		Kruskal,     // Random wall order over a union-find, short dead ends
+		Wilson,      // Loop erased random walks, uniformly random among all perfect mazes
+		GrowingTree  // Active cell list, the texture depends on the GrowingTreePolicy
+	};
+
+	inline GenerationAlgorithm GetNextGenerationAlgorithm(GenerationAlgorithm currentAlgorithm) {
+		return static_cast<GenerationAlgorithm>((static_cast<int>(currentAlgorithm) + 1) % 4);
+	}
+
+	/* Which active cell the growing tree generator carves from */
+	enum class GrowingTreePolicy
+	{
+		Newest, // Backtracker-like long corridors
+		Oldest, // Long straight corridors from the start cell
+		Random, // Prim-like short dead ends
+		Mixed   // Newest with a given weight, random otherwise
+	};
+
+	/* Algorithms stepped by Maze::UpdateSolving */
+	enum class SolvingAlgorithm
+	{
+		Tremaux,              // Random walk marking entrances, then a second walk along the marks
+		BreadthFirst,         // Shortest path in one pass
+		AStar,                // Shortest path, goal directed with the Manhattan distance
+		Bidirectional,        // Shortest path, breadth first from both ends meeting in the middle
+		ParallelBreadthFirst, // Shortest path, one distance layer per step on all cores
+		Bitboard,             // Shortest path, one distance layer per step with word operations on row bitsets
+		DeadEndFilling,       // Fills every dead end corridor, what stays open is the path
+		Dijkstra              // Cheapest path on weighted cells, radix heap open list
+	};
+
+	inline SolvingAlgorithm GetNextSolvingAlgorithm(SolvingAlgorithm currentAlgorithm) {
+		return static_cast<SolvingAlgorithm>((static_cast<int>(currentAlgorithm) + 1) % 8);
+	}
+
+	/* Which end a search reached a cell from, one sided searches only use Start */
+	enum class SearchSide
+	{
+		None,
+		Start,
+		End
+	};
+
+	enum class SelectionPhase
+	{
+		SelectingStart,
+		SelectingEnd
+	};
+
+	typedef std::pair<int, int> Direction; //Just more readable :)
+	inline Direction GetDirection(int index) {
+		Direction Directions[] = {
+			{ 0, -1 }, // Up
+			{ 0, 1 },  // Down
+			{ -1, 0 }, // Left
+			{ 1, 0 }   // Right
+		};
+		return Directions[index];
+	}
+	inline Direction GetInvertedDirection(Direction& direction) {
+		return Direction{ direction.first * -1, direction.second * -1 };
+	}
+
+	/*
+	Cells are addressed by their row-major index into the maze grid (y * width + x).
+	INVALID_CELL is returned for positions outside of the grid.
+	*/
+	typedef int CellIndex;
+	constexpr CellIndex INVALID_CELL = -1;
+
+	/* Bit flags stored in the one byte state of every cell */
+	constexpr uint8_t CELL_WALL = 1 << 0;
+
+	/*
+	Tremaux pass count of an entrance cell, kept in bits 1-3 of the cell state.
+	An entrance between two neighbor junctions is passed from both sides, so it may reach 4.
+	*/
+	constexpr int CELL_PASS_COUNT_SHIFT = 1;
+	constexpr uint8_t CELL_PASS_COUNT_MASK = 0x7 << CELL_PASS_COUNT_SHIFT;
+	constexpr int MAX_PASS_COUNT = 7;
+
+	/* Set on the junction cells met by the Tremaux solver, replaces searching the junction list */
+	constexpr uint8_t CELL_JUNCTION = 1 << 4;
+}
\ No newline at end of file
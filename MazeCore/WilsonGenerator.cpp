@@ -0,0 +1,156 @@
+#include "WilsonGenerator.h"
+#include "Maze.h"
+
+WilsonGenerator::WilsonGenerator(Maze& maze, float aldousBroderFraction) : maze(maze), aldousBroderFraction(aldousBroderFraction)
+{
+	if (this->aldousBroderFraction < 0.0f)
+		this->aldousBroderFraction = 0.0f;
+	if (this->aldousBroderFraction > 1.0f)
+		this->aldousBroderFraction = 1.0f;
+
+	latticeWidth = (maze.GetWidth() - 1) / 2;
+	latticeHeight = (maze.GetHeight() - 1) / 2;
+}
+
+void WilsonGenerator::Start(Random& random)
+{
+	const int latticeCount = latticeWidth * latticeHeight;
+
+	nextDirections.assign(latticeCount, 0);
+	nextWalkStart = 0;
+	walkStart = -1;
+	headCell = Utils::INVALID_CELL;
+
+	if (latticeCount == 0) {
+		stage = Stage::Done;
+		return;
+	}
+
+	/* The tree starts from a single random cell, Aldous-Broder walks on from there */
+	walkHead = random.NextInt(latticeCount);
+	AddToTree(walkHead, -1);
+
+	remainingAldousBroderCells = (int)(aldousBroderFraction * (float)latticeCount) - 1;
+	stage = remainingAldousBroderCells > 0 ? Stage::AldousBroder : Stage::Walking;
+}
+
+/*
+PURPOSE: A single move of the current walk or a single cell added to the tree
+*/
+bool WilsonGenerator::Step(Random& random)
+{
+	switch (stage)
+	{
+	case Stage::AldousBroder:
+	{
+		int direction;
+		walkHead = GetRandomNeighbor(walkHead, random, direction);
+		headCell = GetLatticeCell(walkHead);
+
+		if (!IsInTree(walkHead)) {
+			AddToTree(walkHead, direction);
+
+			if (--remainingAldousBroderCells <= 0)
+				stage = Stage::Walking;
+		}
+		return true;
+	}
+	case Stage::Walking:
+	{
+		if (walkStart == -1) {
+			/* Next cell outside of the tree starts a new walk */
+			const int latticeCount = latticeWidth * latticeHeight;
+
+			while (nextWalkStart < latticeCount && IsInTree(nextWalkStart))
+				nextWalkStart++;
+
+			if (nextWalkStart == latticeCount) {
+				stage = Stage::Done;
+				headCell = Utils::INVALID_CELL;
+				return false;
+			}
+
+			walkStart = nextWalkStart;
+			walkHead = walkStart;
+		}
+
+		/* Leaving a cell again overwrites its direction, this is what erases the loops */
+		int direction;
+		int nextCell = GetRandomNeighbor(walkHead, random, direction);
+
+		nextDirections[walkHead] = (uint8_t)direction;
+		walkHead = nextCell;
+		headCell = GetLatticeCell(walkHead);
+
+		if (IsInTree(walkHead)) {
+			walkHead = walkStart;
+			stage = Stage::Carving;
+		}
+		return true;
+	}
+	case Stage::Carving:
+	{
+		/* Follow the directions from the walk start, each cell opens the wall towards the next one */
+		int direction = nextDirections[walkHead];
+		Utils::Direction offset = Utils::GetDirection(direction);
+
+		maze.SetWall(GetLatticeCell(walkHead), false);
+		maze.SetWall(maze.GetCellTowardsDirection(GetLatticeCell(walkHead), offset), false);
+
+		headCell = GetLatticeCell(walkHead);
+		walkHead += offset.first + offset.second * latticeWidth;
+
+		if (IsInTree(walkHead)) {
+			walkStart = -1;
+			stage = Stage::Walking;
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+/*
+PURPOSE: Picks a uniformly random neighbor inside the lattice, <direction> is set to the index of the move
+*/
+int WilsonGenerator::GetRandomNeighbor(int latticeIndex, Random& random, int& direction) const
+{
+	const int latticeX = latticeIndex % latticeWidth;
+	const int latticeY = latticeIndex / latticeWidth;
+
+	int directions[4];
+	int directionCount = 0;
+
+	/* Same order as Utils::GetDirection */
+	if (latticeY > 0) directions[directionCount++] = 0;
+	if (latticeY + 1 < latticeHeight) directions[directionCount++] = 1;
+	if (latticeX > 0) directions[directionCount++] = 2;
+	if (latticeX + 1 < latticeWidth) directions[directionCount++] = 3;
+
+	/* A single cell maze has nowhere to go, but it is complete before any walk */
+	direction = directions[random.NextInt(directionCount)];
+
+	Utils::Direction offset = Utils::GetDirection(direction);
+	return latticeIndex + offset.first + offset.second * latticeWidth;
+}
+
+bool WilsonGenerator::IsInTree(int latticeIndex) const
+{
+	return !maze.IsWall(GetLatticeCell(latticeIndex));
+}
+
+void WilsonGenerator::AddToTree(int latticeIndex, int direction)
+{
+	Utils::CellIndex cell = GetLatticeCell(latticeIndex);
+	maze.SetWall(cell, false);
+
+	/* The wall is between this cell and the one it was entered from */
+	if (direction != -1)
+		maze.SetWall(maze.GetCellTowardsDirection(cell, Utils::GetDirection(direction), -1), false);
+}
+
+Utils::CellIndex WilsonGenerator::GetLatticeCell(int latticeIndex) const
+{
+	return maze.GetCellFromXY(2 * (latticeIndex % latticeWidth) + 1, 2 * (latticeIndex / latticeWidth) + 1);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+/*
+
+WilsonGenerator class that generates a uniformly random perfect maze with Wilson's algorithm.
+From every cell outside of the tree a random walk runs until it hits the tree, then the loop erased walk is added to the tree.
+Loops are erased in place, every cell keeps the direction the walk last left it with,
+so following those directions from the walk start gives the loop erased path and walks allocate nothing.
+
+The first walks are long while the tree is small, optionally the tree is seeded by an Aldous-Broder walk
+which visits a share of the cells first. Each algorithm alone gives uniform spanning trees,
+but the hybrid is only close to uniform, as the tree left by a partial Aldous-Broder walk is not a uniform one.
+
+*/
+
+#include "StepGenerator.h"
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+
+class WilsonGenerator : public StepGenerator
+{
+public:
+	WilsonGenerator() = delete;
+	WilsonGenerator(Maze& maze, float aldousBroderFraction);
+
+	WilsonGenerator(const WilsonGenerator& other) = delete;
+	WilsonGenerator& operator=(const WilsonGenerator& other) = delete;
+
+	void Start(Random& random) override;
+	bool Step(Random& random) override;
+
+	Utils::CellIndex GetHeadCell() const override { return headCell; }
+
+private:
+	enum class Stage
+	{
+		AldousBroder, // Random walk adding every new cell it meets
+		Walking,      // Random walk from a cell outside of the tree until it hits the tree
+		Carving,      // Adding the loop erased walk to the tree
+		Done
+	};
+
+	int GetRandomNeighbor(int latticeIndex, Random& random, int& direction) const;
+
+	/* Helpers */
+	bool IsInTree(int latticeIndex) const;
+	void AddToTree(int latticeIndex, int direction); // Opens the cell and the wall it came through, direction -1 is the root
+	Utils::CellIndex GetLatticeCell(int latticeIndex) const;
+
+private:
+	Maze& maze;
+
+	float aldousBroderFraction;
+
+	int latticeWidth;  // Odd cells on a row
+	int latticeHeight; // Odd cells on a column
+
+	Stage stage = Stage::Done;
+
+	std::vector<uint8_t> nextDirections; // Direction the walk last left each cell with
+
+	int remainingAldousBroderCells = 0;
+	int nextWalkStart = 0; // Cells before it are all in the tree
+	int walkStart = -1;
+	int walkHead = -1;
+
+	Utils::CellIndex headCell = Utils::INVALID_CELL;
+};
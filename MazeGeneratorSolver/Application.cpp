@@ -1,6 +1,16 @@
 #include "Application.h"
 
 bool Application::spacePressed = false;
+bool Application::stepModeKeyPressed = false;
+bool Application::speedUpKeyPressed = false;
+bool Application::speedDownKeyPressed = false;
+bool Application::generationAlgorithmKeyPressed = false;
+bool Application::solvingAlgorithmKeyPressed = false;
+bool Application::farthestCellsKeyPressed = false;
+bool Application::heatmapKeyPressed = false;
+bool Application::editingKeyPressed = false;
+bool Application::exitsKeyPressed = false;
+bool Application::costsKeyPressed = false;
 bool Application::leftMouseClicked = false;
 bool Application::rightMousePressed = false;
 bool Application::mouseWheelUp = false;
@@ -43,10 +53,15 @@ void Application::Initialize()
 	SetGLFWCallbacks();
 
     InitializeShaders();
+
+    mazeRenderer.Initialize();
 }
 
 void Application::Cleanup()
 {
+    /* OpenGL objects must be deleted while the context still exists */
+    mazeRenderer.Cleanup();
+
     if (window) {
         glfwDestroyWindow(window);
         window = nullptr;
@@ -151,7 +166,16 @@ void Application::Update()
         rightFirstPress = true;
     UpdateCameraZoom();
 
-    /* We update maze only each <mazeUpdateInterval> seconds */
+    UpdateSteppingMode();
+    UpdateGenerationAlgorithm();
+    UpdateSolvingAlgorithm();
+    UpdateFarthestCells();
+    UpdateHeatmap();
+    UpdateWallEditing();
+    UpdateExitSelection();
+    UpdateCellCosts();
+
+    /* In interval mode we update maze only each <mazeUpdateInterval> seconds, other modes update it every frame */
     bool updateMaze = false;
 
     if (!phaseCompleted &&
@@ -159,11 +183,16 @@ void Application::Update()
             currentPhase == Utils::Phase::Solving ||
             currentPhase == Utils::Phase::CellSelection ||
             currentPhase == Utils::Phase::Completed)) {
-        float currentTime = static_cast<float>(glfwGetTime());
+        if (steppingMode == Utils::SteppingMode::Interval) {
+            float currentTime = static_cast<float>(glfwGetTime());
 
-        if (currentTime - lastMazeUpdateTime >= mazeUpdateInterval) {
+            if (currentTime - lastMazeUpdateTime >= mazeUpdateInterval) {
+                updateMaze = true;
+                lastMazeUpdateTime = currentTime;
+            }
+        }
+        else {
             updateMaze = true;
-			lastMazeUpdateTime = currentTime;
         }
     }
 
@@ -176,15 +205,28 @@ void Application::Update()
 		leftMouseClickedLocal = true;
 
     if (maze && updateMaze) {
-        maze->UpdateMaze(mouseX, mouseY, cameraX, cameraY, cameraZoom, leftMouseClickedLocal);
-        if (IsCurrentPhaseCompleted()) {
-            if (maze->IsSolvingComplete()) {
-                UpdatePhase();
-            }
-            else {
-                phaseCompleted = true;
+        int pointedCellX = 0;
+        int pointedCellY = 0;
+        mazeRenderer.GetCellFromMouse(mouseX, mouseY, cameraX, cameraY, cameraZoom, pointedCellX, pointedCellY);
+
+        /* Cell selection waits for the user, so it is never stepped more than once per frame */
+        if (steppingMode == Utils::SteppingMode::Interval || currentPhase == Utils::Phase::CellSelection) {
+            StepMaze(pointedCellX, pointedCellY, leftMouseClickedLocal);
+        }
+        else if (steppingMode == Utils::SteppingMode::Turbo) {
+            /* Run as many steps as fit into the frame budget, the clock is checked once per STEPS_PER_TIME_CHECK steps */
+            double deadline = glfwGetTime() + frameBudget / 1000.0;
+            bool phaseEnded = false;
+
+            while (!phaseEnded && glfwGetTime() < deadline) {
+                for (int i = 0; i < STEPS_PER_TIME_CHECK && !phaseEnded; ++i)
+                    phaseEnded = StepMaze(pointedCellX, pointedCellY, leftMouseClickedLocal);
             }
         }
+        else {
+            /* Instant mode runs the phase to the end, it is rendered once afterwards */
+            while (!StepMaze(pointedCellX, pointedCellY, leftMouseClickedLocal));
+        }
 
 		leftMouseClickedLocal = false;
     }
@@ -195,6 +237,257 @@ void Application::Update()
     mouseWheelDown = false;
 }
 
+/*
+PURPOSE: Runs a single step of the maze and handles the end of the current phase.
+	Returns true when the current phase has ended, so callers stepping in a loop know when to stop.
+*/
+bool Application::StepMaze(int pointedCellX, int pointedCellY, bool leftMouseClickedLocal)
+{
+    maze->UpdateMaze(pointedCellX, pointedCellY, leftMouseClickedLocal);
+
+    if (!IsCurrentPhaseCompleted())
+        return false;
+
+    if (maze->IsSolvingComplete()) {
+        UpdatePhase();
+    }
+    else {
+        phaseCompleted = true;
+    }
+
+    return true;
+}
+
+/*
+PURPOSE: Changes stepping mode and speed with the keyboard
+	M cycles Interval -> Turbo -> Instant, +/- makes interval mode faster/slower or turbo mode budget bigger/smaller
+*/
+void Application::UpdateSteppingMode()
+{
+    if (stepModeKeyPressed) {
+        steppingMode = Utils::GetNextSteppingMode(steppingMode);
+    }
+
+    if (speedUpKeyPressed) {
+        if (steppingMode == Utils::SteppingMode::Interval)
+            mazeUpdateInterval = std::max(mazeUpdateInterval / 2.0f, MIN_SIMULATION_INTERVAL);
+        else if (steppingMode == Utils::SteppingMode::Turbo)
+            frameBudget = std::min(frameBudget * 2.0f, MAX_FRAME_BUDGET);
+    }
+
+    if (speedDownKeyPressed) {
+        if (steppingMode == Utils::SteppingMode::Interval)
+            mazeUpdateInterval = std::min(mazeUpdateInterval * 2.0f, MAX_SIMULATION_INTERVAL);
+        else if (steppingMode == Utils::SteppingMode::Turbo)
+            frameBudget = std::max(frameBudget / 2.0f, MIN_FRAME_BUDGET);
+    }
+
+    if (stepModeKeyPressed || speedUpKeyPressed || speedDownKeyPressed) {
+        switch (steppingMode)
+        {
+        case Utils::SteppingMode::Interval:
+            std::cout << "Stepping: Interval, a step per " << mazeUpdateInterval << " seconds" << std::endl;
+            break;
+        case Utils::SteppingMode::Turbo:
+            std::cout << "Stepping: Turbo, " << frameBudget << " ms of steps per frame" << std::endl;
+            break;
+        case Utils::SteppingMode::Instant:
+            std::cout << "Stepping: Instant, phases run to the end" << std::endl;
+            break;
+        default:
+            break;
+        }
+    }
+
+    stepModeKeyPressed = false;
+    speedUpKeyPressed = false;
+    speedDownKeyPressed = false;
+}
+
+/*
+PURPOSE: G cycles the generation algorithm, the new one is used when the next maze is generated
+*/
+void Application::UpdateGenerationAlgorithm()
+{
+    if (!generationAlgorithmKeyPressed)
+        return;
+
+    generationAlgorithm = Utils::GetNextGenerationAlgorithm(generationAlgorithm);
+
+    switch (generationAlgorithm)
+    {
+    case Utils::GenerationAlgorithm::Backtracker:
+        std::cout << "Generation: Backtracker" << std::endl;
+        break;
+    case Utils::GenerationAlgorithm::Kruskal:
+        std::cout << "Generation: Kruskal" << std::endl;
+        break;
+    case Utils::GenerationAlgorithm::Wilson:
+        std::cout << "Generation: Wilson" << std::endl;
+        break;
+    case Utils::GenerationAlgorithm::GrowingTree:
+        std::cout << "Generation: Growing Tree" << std::endl;
+        break;
+    default:
+        break;
+    }
+
+    generationAlgorithmKeyPressed = false;
+}
+
+/*
+PURPOSE: S cycles the solving algorithm, the new one is used when the next solving starts
+*/
+void Application::UpdateSolvingAlgorithm()
+{
+    if (!solvingAlgorithmKeyPressed)
+        return;
+
+    solvingAlgorithm = Utils::GetNextSolvingAlgorithm(solvingAlgorithm);
+
+    switch (solvingAlgorithm)
+    {
+    case Utils::SolvingAlgorithm::Tremaux:
+        std::cout << "Solving: Tremaux" << std::endl;
+        break;
+    case Utils::SolvingAlgorithm::BreadthFirst:
+        std::cout << "Solving: Breadth First" << std::endl;
+        break;
+    case Utils::SolvingAlgorithm::AStar:
+        std::cout << "Solving: A*" << std::endl;
+        break;
+    case Utils::SolvingAlgorithm::Bidirectional:
+        std::cout << "Solving: Bidirectional Breadth First" << std::endl;
+        break;
+    case Utils::SolvingAlgorithm::ParallelBreadthFirst:
+        std::cout << "Solving: Parallel Breadth First" << std::endl;
+        break;
+    case Utils::SolvingAlgorithm::Bitboard:
+        std::cout << "Solving: Bitboard Breadth First" << std::endl;
+        break;
+    case Utils::SolvingAlgorithm::DeadEndFilling:
+        std::cout << "Solving: Dead End Filling" << std::endl;
+        break;
+    case Utils::SolvingAlgorithm::Dijkstra:
+        std::cout << "Solving: Dijkstra (weighted cells)" << std::endl;
+        break;
+    default:
+        break;
+    }
+
+    solvingAlgorithmKeyPressed = false;
+}
+
+/*
+PURPOSE: F selects the two ends of the longest path as start and end points while the cells are being selected
+*/
+void Application::UpdateFarthestCells()
+{
+    if (!farthestCellsKeyPressed)
+        return;
+
+    if (maze && currentPhase == Utils::Phase::CellSelection && !phaseCompleted)
+        maze->SelectFarthestCells();
+
+    farthestCellsKeyPressed = false;
+}
+
+/*
+PURPOSE: H shows or hides the distances from the start point (or the top left cell before it is selected) as a heatmap
+*/
+void Application::UpdateHeatmap()
+{
+    if (!heatmapKeyPressed)
+        return;
+
+    if (maze && maze->IsGenerationComplete()) {
+        if (maze->GetDistanceField()) {
+            maze->ClearDistanceField();
+        }
+        else {
+            Utils::CellIndex sourceCell = maze->HasSolveStartCell() ? maze->GetSolveStartCell() : maze->GetCellFromXY(1, 1);
+            maze->ComputeDistanceField(sourceCell);
+            std::cout << "Heatmap: farthest cell is " << maze->GetDistanceField()->GetMaxDistance() << " cells away" << std::endl;
+        }
+    }
+
+    heatmapKeyPressed = false;
+}
+
+/*
+PURPOSE: E starts or stops editing walls after the completed phase ended, while editing a click toggles the wall of the pointed cell
+*/
+void Application::UpdateWallEditing()
+{
+    if (editingKeyPressed && maze && currentPhase == Utils::Phase::Completed && phaseCompleted) {
+        if (maze->IsEditing()) {
+            maze->StopEditing();
+            std::cout << "Editing Stopped" << std::endl;
+        }
+        else {
+            maze->StartEditing();
+        }
+    }
+
+    editingKeyPressed = false;
+
+    /* Editing runs every frame, so clicks are never missed and long repairs continue on the next frames */
+    if (maze && maze->IsEditing()) {
+        int pointedCellX = 0;
+        int pointedCellY = 0;
+        mazeRenderer.GetCellFromMouse(mouseX, mouseY, cameraX, cameraY, cameraZoom, pointedCellX, pointedCellY);
+
+        maze->UpdateEditing(pointedCellX, pointedCellY, leftMouseClicked);
+    }
+}
+
+/*
+PURPOSE: X starts or stops selecting exits after the completed phase ended, while selecting a click adds or removes the pointed cell as an exit
+*/
+void Application::UpdateExitSelection()
+{
+    if (exitsKeyPressed && maze && currentPhase == Utils::Phase::Completed && phaseCompleted) {
+        if (maze->IsSelectingExits()) {
+            maze->StopExitSelection();
+            std::cout << "Exit Selection Stopped" << std::endl;
+        }
+        else {
+            maze->StartExitSelection();
+        }
+    }
+
+    exitsKeyPressed = false;
+
+    if (maze && maze->IsSelectingExits()) {
+        int pointedCellX = 0;
+        int pointedCellY = 0;
+        mazeRenderer.GetCellFromMouse(mouseX, mouseY, cameraX, cameraY, cameraZoom, pointedCellX, pointedCellY);
+
+        maze->UpdateExitSelection(pointedCellX, pointedCellY, leftMouseClicked);
+    }
+}
+
+/*
+PURPOSE: W adds costs of a noise field to the cells or removes them while the maze is generated and not being solved, only Dijkstra uses them
+*/
+void Application::UpdateCellCosts()
+{
+    if (!costsKeyPressed)
+        return;
+
+    if (maze && maze->IsGenerationComplete() && !maze->IsSolving() && !maze->IsCompleting()) {
+        if (maze->HasCellCosts()) {
+            maze->ClearCellCosts();
+            std::cout << "Cell costs cleared, every cell costs 1" << std::endl;
+        }
+        else {
+            maze->GenerateCellCosts(CELL_COST_FEATURE_SIZE, MAX_CELL_COST);
+        }
+    }
+
+    costsKeyPressed = false;
+}
+
 void Application::Render()
 {
     /* Render frame here */
@@ -225,7 +518,7 @@ void Application::Render()
     glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "scale"), 1, GL_FALSE, scaleMatrix);
 
     if(maze)
-		maze->DrawMaze(shaderProgram, cameraX, cameraY);
+		mazeRenderer.DrawMaze(*maze, shaderProgram, cameraX, cameraY);
 }
 
 void Application::HandlePhaseIdle()
@@ -246,7 +539,11 @@ void Application::HandlePhaseGeneration()
     }
 
     /* Start to generate */
-	maze->GenerateMaze(cameraX, cameraY, cameraZoom);
+	maze->SetGenerationAlgorithm(generationAlgorithm);
+	maze->SetAldousBroderFraction((float)WILSON_ALDOUS_BRODER_FRACTION);
+	maze->SetGrowingTreePolicy(GROWING_TREE_POLICY, (float)GROWING_TREE_NEWEST_WEIGHT);
+	maze->GenerateMaze();
+	mazeRenderer.FitCameraToMaze(*maze, cameraX, cameraY, cameraZoom);
 }
 
 void Application::HandlePhaseCellSelection()
@@ -259,8 +556,10 @@ void Application::HandlePhaseCellSelection()
 void Application::HandlePhaseSolving()
 {
     /* Start to solve */
-    if(maze)
+    if (maze) {
+        maze->SetSolvingAlgorithm(solvingAlgorithm);
 		maze->SolveMaze();
+    }
 }
 
 void Application::HandlePhaseCompleted()
@@ -357,6 +656,38 @@ void Application::KeyCallback(GLFWwindow* window, int key, int scancode, int act
 {
     if (key == GLFW_KEY_SPACE && action == GLFW_PRESS)
         spacePressed = true;
+
+    if (key == GLFW_KEY_M && action == GLFW_PRESS)
+        stepModeKeyPressed = true;
+
+    if (key == GLFW_KEY_G && action == GLFW_PRESS)
+        generationAlgorithmKeyPressed = true;
+
+    if (key == GLFW_KEY_S && action == GLFW_PRESS)
+        solvingAlgorithmKeyPressed = true;
+
+    if (key == GLFW_KEY_F && action == GLFW_PRESS)
+        farthestCellsKeyPressed = true;
+
+    if (key == GLFW_KEY_H && action == GLFW_PRESS)
+        heatmapKeyPressed = true;
+
+    if (key == GLFW_KEY_E && action == GLFW_PRESS)
+        editingKeyPressed = true;
+
+    if (key == GLFW_KEY_X && action == GLFW_PRESS)
+        exitsKeyPressed = true;
+
+    if (key == GLFW_KEY_W && action == GLFW_PRESS)
+        costsKeyPressed = true;
+
+    /* Holding the keys keeps changing the speed */
+    if (action == GLFW_PRESS || action == GLFW_REPEAT) {
+        if (key == GLFW_KEY_EQUAL || key == GLFW_KEY_KP_ADD)
+            speedUpKeyPressed = true;
+        if (key == GLFW_KEY_MINUS || key == GLFW_KEY_KP_SUBTRACT)
+            speedDownKeyPressed = true;
+    }
 }
 
 void Application::MouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
@@ -14,8 +14,9 @@ Date: December 7, 2025
 #include "Settings.h"
 #include "Utils.h"
 
-/* Maze class */
+/* Maze class and its renderer */
 #include "Maze.h"
+#include "MazeRenderer.h"
 
 /* GLAD and GLFW */
 #include <glad/glad.h>
@@ -24,6 +25,7 @@ Date: December 7, 2025
 /* STL */
 #include <string>
 #include <iostream>
+#include <algorithm>
 
 class Application
 {
@@ -54,6 +56,17 @@ private:
 	void Update();
 	void Render();
 
+	/* Maze stepping */
+	bool StepMaze(int pointedCellX, int pointedCellY, bool leftMouseClickedLocal);
+	void UpdateSteppingMode();
+	void UpdateGenerationAlgorithm();
+	void UpdateSolvingAlgorithm();
+	void UpdateFarthestCells();
+	void UpdateHeatmap();
+	void UpdateWallEditing();
+	void UpdateExitSelection();
+	void UpdateCellCosts();
+
 	/* Phase */
 	void HandlePhaseIdle();
 	void HandlePhaseGeneration();
@@ -82,11 +95,22 @@ private:
 	unsigned int shaderProgram = 0;
 
 	Maze* maze = nullptr;
+	MazeRenderer mazeRenderer;
 
 	Utils::Phase currentPhase = Utils::Phase::Idle;
 	bool phaseCompleted = true;
 
 	static bool spacePressed;
+	static bool stepModeKeyPressed;
+	static bool speedUpKeyPressed;
+	static bool speedDownKeyPressed;
+	static bool generationAlgorithmKeyPressed;
+	static bool solvingAlgorithmKeyPressed;
+	static bool farthestCellsKeyPressed;
+	static bool heatmapKeyPressed;
+	static bool editingKeyPressed;
+	static bool exitsKeyPressed;
+	static bool costsKeyPressed;
 	static bool leftMouseClicked;
 	static bool rightMousePressed;
 	static bool mouseWheelUp;
@@ -105,4 +129,16 @@ private:
 
 	float lastMazeUpdateTime = 0.0f;
 	float mazeUpdateInterval = (float)SIMULATION_INTERVAL;
+
+	Utils::GenerationAlgorithm generationAlgorithm = Utils::GenerationAlgorithm::Backtracker; // Used by the next generation
+	Utils::SolvingAlgorithm solvingAlgorithm = Utils::SolvingAlgorithm::Tremaux; // Used by the next solving
+
+	Utils::SteppingMode steppingMode = Utils::SteppingMode::Interval;
+	float frameBudget = (float)SIMULATION_FRAME_BUDGET; // Milliseconds of maze steps per frame in turbo mode
+
+	static constexpr float MIN_SIMULATION_INTERVAL = 0.001f;
+	static constexpr float MAX_SIMULATION_INTERVAL = 1.0f;
+	static constexpr float MIN_FRAME_BUDGET = 0.5f;
+	static constexpr float MAX_FRAME_BUDGET = 250.0f;
+	static constexpr int STEPS_PER_TIME_CHECK = 256;
 };
\ No newline at end of file
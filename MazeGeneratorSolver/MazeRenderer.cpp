@@ -0,0 +1,202 @@
+#include "MazeRenderer.h"
+
+void MazeRenderer::Initialize()
+{
+	float* gridVertices = GenerateGridVertices((float)cellHalfSize, (float)cellHalfSize);
+
+	glGenBuffers(1, &mazeCellBuffer);
+	glGenVertexArrays(1, &mazeCellVAO);
+	
+	glBindVertexArray(mazeCellVAO);
+	glBindBuffer(GL_ARRAY_BUFFER, mazeCellBuffer);
+	
+	glBufferData(GL_ARRAY_BUFFER, 8 * sizeof(float), gridVertices, GL_STATIC_DRAW);
+
+	glEnableVertexArrayAttrib(mazeCellBuffer, 0);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0); // Unbind buffer
+	glBindVertexArray(0); // Unbind VAO
+	delete[] gridVertices; // Free allocated memory
+}
+
+void MazeRenderer::Cleanup()
+{
+	/* OpenGL objects are only created after Initialize() */
+	if (mazeCellBuffer) {
+		glDeleteBuffers(1, &mazeCellBuffer);
+		mazeCellBuffer = 0;
+	}
+	if (mazeCellVAO) {
+		glDeleteVertexArrays(1, &mazeCellVAO);
+		mazeCellVAO = 0;
+	}
+}
+
+void MazeRenderer::DrawMaze(const Maze& maze, unsigned int shaderProgram, float cameraX, float cameraY)
+{
+	const int cellCount = maze.GetCellCount();
+	const StepSolver* stepSolver = maze.GetStepSolver();
+	const DistanceField* distanceField = maze.GetDistanceField();
+	const ExitField* exitField = maze.GetExitField();
+
+	/* Region colors of the exits, repeated when there are more exits */
+	static const float regionColors[6][3] = {
+		{ 0.15f, 0.35f, 0.6f }, { 0.55f, 0.25f, 0.2f }, { 0.2f, 0.5f, 0.25f },
+		{ 0.5f, 0.4f, 0.1f }, { 0.4f, 0.2f, 0.5f }, { 0.15f, 0.45f, 0.45f }
+	};
+
+	for(Utils::CellIndex cell = 0; cell < cellCount; ++cell) {
+		if(maze.IsWall(cell)) {
+			DrawCell(maze, shaderProgram, cameraX, cameraY, 1.0f, 1.0f, 1.0f, cell);
+		}
+		else if (exitField && exitField->IsComputed() && exitField->GetOwner(cell) >= 0) {
+			/* Ownership map, every cell has the color of its nearest exit */
+			const float* color = regionColors[exitField->GetOwner(cell) % 6];
+			DrawCell(maze, shaderProgram, cameraX, cameraY, color[0], color[1], color[2], cell);
+		}
+		else if (distanceField && distanceField->GetDistance(cell) >= 0) {
+			/* Heatmap, blue near the source cell and red at the farthest cell */
+			float heat = (float)distanceField->GetDistance(cell) / (float)std::max(distanceField->GetMaxDistance(), 1);
+			DrawCell(maze, shaderProgram, cameraX, cameraY, heat, 0.15f, 1.0f - heat, cell);
+		}
+		else if (stepSolver && stepSolver->GetVisitedSide(cell) != Utils::SearchSide::None) {
+			/* Cells reached by the search, darker colors than the frontiers */
+			if (stepSolver->GetVisitedSide(cell) == Utils::SearchSide::Start)
+				DrawCell(maze, shaderProgram, cameraX, cameraY, 0.15f, 0.2f, 0.45f, cell);
+			else
+				DrawCell(maze, shaderProgram, cameraX, cameraY, 0.45f, 0.3f, 0.1f, cell);
+		}
+		else if (maze.GetCellCost(cell) > 1) {
+			/* Cell costs, the costliest cells are the deepest blue */
+			float depth = std::min((float)maze.GetCellCost(cell) / (float)MAX_CELL_COST, 1.0f);
+			DrawCell(maze, shaderProgram, cameraX, cameraY, 0.05f, 0.1f + 0.15f * depth, 0.15f + 0.45f * depth, cell);
+		}
+	}
+
+	if (stepSolver && maze.IsSolving()) {
+		startFrontier.clear();
+		endFrontier.clear();
+		stepSolver->GetFrontier(startFrontier, endFrontier);
+
+		for (const auto& frontierCell : startFrontier)
+			DrawCell(maze, shaderProgram, cameraX, cameraY, 0.3f, 0.6f, 1.0f, frontierCell);
+
+		for (const auto& frontierCell : endFrontier)
+			DrawCell(maze, shaderProgram, cameraX, cameraY, 1.0f, 0.6f, 0.2f, frontierCell);
+	}
+
+	if(maze.GetGenerationHeadCell() != Utils::INVALID_CELL)
+		DrawCell(maze, shaderProgram, cameraX, cameraY, 0.0f, 1.0f, 0.0f, maze.GetGenerationHeadCell());
+
+	if((maze.IsSelectingCells() || maze.IsEditing() || maze.IsSelectingExits()) && maze.IsPointing())
+		DrawCell(maze, shaderProgram, cameraX, cameraY, 1.0f, 0.0f, 0.0f, maze.GetPointedCell());
+
+	if (maze.IsSolving()) {
+		for (const auto& passedEntrance : maze.GetPassedEntrances()) {
+			int passCount = maze.GetPassCount(passedEntrance);
+
+			if (passCount == 1)
+				DrawCell(maze, shaderProgram, cameraX, cameraY, 0.0f, 1.0f, 1.0f, passedEntrance);
+			else if (passCount >= 2)
+				DrawCell(maze, shaderProgram, cameraX, cameraY, 0.5f, 0.5f, 0.5f, passedEntrance);
+		}
+	}
+
+	for (const auto& solvePathCell : maze.GetSolvePath()) {
+		DrawCell(maze, shaderProgram, cameraX, cameraY, 0.0f, 0.7f, 0.7f, solvePathCell);
+	}
+
+	if(maze.HasSolveStartCell())
+		DrawCell(maze, shaderProgram, cameraX, cameraY, 0.0f, 0.0f, 1.0f, maze.GetSolveStartCell());
+
+	if (maze.HasSolveEndCell())
+		DrawCell(maze, shaderProgram, cameraX, cameraY, 1.0f, 1.0f, 0.0f, maze.GetSolveEndCell());
+
+	if (exitField) {
+		for (const auto& exitCell : exitField->GetExitCells())
+			DrawCell(maze, shaderProgram, cameraX, cameraY, 1.0f, 1.0f, 0.0f, exitCell);
+	}
+
+	if (maze.IsCompleting())
+		DrawCell(maze, shaderProgram, cameraX, cameraY, 0.5f, 0.0f, 0.0f, maze.GetCurrentCompleteCell());
+
+	if (maze.IsSolving() && maze.GetCurrentSolveCell() != Utils::INVALID_CELL)
+		DrawCell(maze, shaderProgram, cameraX, cameraY, 1.0f, 0.0f, 1.0f, maze.GetCurrentSolveCell());
+}
+
+/*
+PURPOSE: Set camera position and zoom to fit maze into screen without any navigation process
+*/
+void MazeRenderer::FitCameraToMaze(const Maze& maze, float& cameraXAfterSet, float& cameraYAfterSet, float& cameraZoomAfterSet) const
+{
+	float mazeWorldWidth = cellHalfSize * 2.0f * maze.GetWidth();
+	float mazeWorldHeight = cellHalfSize * 2.0f * maze.GetHeight();
+
+	float zoomX = WINDOW_WIDTH / mazeWorldWidth * 0.8f;
+	float zoomY = WINDOW_HEIGHT / mazeWorldHeight * 0.8f;
+
+	cameraZoomAfterSet = (zoomX < zoomY) ? zoomX : zoomY;
+
+	float mazeCenterX = mazeWorldWidth / 2.0f - cellHalfSize;
+	float mazeCenterY = mazeWorldHeight / 2.0f - cellHalfSize;
+
+	cameraXAfterSet = mazeCenterX;
+	cameraYAfterSet = mazeCenterY;
+}
+
+/*
+PURPOSE: Converts mouse position into cell coordinates, the result may be outside of the maze
+*/
+void MazeRenderer::GetCellFromMouse(int mouseX, int mouseY, float cameraX, float cameraY, float cameraZoom, int& cellX, int& cellY) const
+{
+	/* Convert mouse coordinates into our coordinate system */
+	float worldMouseX = mouseX / cameraZoom + cameraX;
+	float worldMouseY = mouseY / cameraZoom + cameraY;
+
+	/* Use world mouse position to find pointed cell */
+	cellX = (int)((worldMouseX + cellHalfSize) / (cellHalfSize * 2.0f));
+	cellY = (int)((worldMouseY + cellHalfSize) / (cellHalfSize * 2.0f));
+}
+
+/*
+PURPOSE: Draws a single cell at given position with specified color.
+	This function sends the color of the cell to the fragment shader
+	to avoid creating multiple VAOs for different colors.
+*/
+void MazeRenderer::DrawCell(const Maze& maze, unsigned int shaderProgram, float cameraX, float cameraY, float r, float g, float b, Utils::CellIndex cell)
+{
+	/* Send translation matrix */
+	int translateX = maze.GetCellX(cell) * cellHalfSize * 2;
+	int translateY = maze.GetCellY(cell) * cellHalfSize * 2;
+	float translationMatrix[16] = {
+		1, 0, 0, 0,
+		0, 1, 0, 0,
+		0, 0, 1, 0,
+		(float)(translateX - cameraX), (float)(translateY - cameraY), 0, 1
+	};
+	glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "translation"), 1, GL_FALSE, translationMatrix);
+
+	/* Send color */
+	glUniform3f(glGetUniformLocation(shaderProgram, "cellColor"), r, g, b);
+
+	/* Render cell here */
+	glBindVertexArray(mazeCellVAO); // Bind VAO
+	glDrawArrays(GL_QUADS, 0, 4);
+	glBindVertexArray(0); // Unbind VAO
+}
+
+/*
+WARNING: Use delete[] after usage to avoid memory leaks.
+*/
+float* MazeRenderer::GenerateGridVertices(float gridW, float gridH)
+{
+	float* gridVertices = new float[8];
+
+	gridVertices[0] = -gridW; gridVertices[1] = -gridH;
+	gridVertices[2] = gridW; gridVertices[3] = -gridH;
+	gridVertices[4] = gridW; gridVertices[5] = gridH;
+	gridVertices[6] = -gridW; gridVertices[7] = gridH;
+
+	return gridVertices;
+}
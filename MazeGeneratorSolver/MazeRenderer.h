@@ -0,0 +1,57 @@
+#pragma once
+
+/*
+
+MazeRenderer class that draws the state of a Maze with OpenGL.
+The maze core library is not aware of this class, the renderer only reads maze state through const accessors.
+
+*/
+
+#include "Settings.h"
+#include "Utils.h"
+
+/* Maze class */
+#include "Maze.h"
+
+/* GLAD */
+#include <glad/glad.h>
+
+class MazeRenderer
+{
+public:
+	MazeRenderer() = default;
+
+	/* Avoid double deletion of OpenGL objects by disallowing copying */
+	MazeRenderer(const MazeRenderer& other) = delete;
+	MazeRenderer& operator=(const MazeRenderer& other) = delete;
+
+	~MazeRenderer()
+	{
+		Cleanup();
+	}
+
+	void Initialize(); // Needs a current OpenGL context
+	void Cleanup();
+
+	void DrawMaze(const Maze& maze, unsigned int shaderProgram, float cameraX, float cameraY);
+
+	void FitCameraToMaze(const Maze& maze, float& cameraXAfterSet, float& cameraYAfterSet, float& cameraZoomAfterSet) const;
+	void GetCellFromMouse(int mouseX, int mouseY, float cameraX, float cameraY, float cameraZoom, int& cellX, int& cellY) const;
+
+private:
+	void DrawCell(const Maze& maze, unsigned int shaderProgram, float cameraX, float cameraY, float r, float g, float b, Utils::CellIndex cell);
+
+	/* Helpers */
+	float* GenerateGridVertices(float gridW, float gridH);
+
+private:
+	int cellHalfSize = 10; // Size of each cell in pixels
+
+	/* Reused every frame to read the search frontiers of step solvers */
+	std::vector<Utils::CellIndex> startFrontier;
+	std::vector<Utils::CellIndex> endFrontier;
+
+private:
+	unsigned int mazeCellBuffer = 0; // OpenGL buffer for maze cells
+	unsigned int mazeCellVAO = 0;    // OpenGL Vertex Array Object for maze cells
+};
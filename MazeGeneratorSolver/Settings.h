@@ -10,6 +10,9 @@ Date: December 7, 2025
 
 */
 
+/* Maze core settings (seed, debug printing) live in MazeSettings.h of the MazeCore library */
+#include "MazeSettings.h"
+
 /* ------- SETTINGS ------- */
 
 /*
@@ -19,9 +22,18 @@ Change these values to modify the window dimensions and title used in the applic
 #define WINDOW_HEIGHT 600
 #define WINDOW_TITLE "Maze Generator and Solver"
 
-/* Change this value to set simulation interval, for example, it updates every 0.01 seconds by default */
+/*
+Change this value to set simulation interval, for example, it updates every 0.01 seconds by default
+It is only the starting value, press +/- to change it while running
+*/
 #define SIMULATION_INTERVAL 0.01
 
+/*
+Change this value to set how many milliseconds of maze steps are run in each frame in turbo stepping mode
+Press M to switch between interval, turbo and instant stepping modes while running
+*/
+#define SIMULATION_FRAME_BUDGET 8.0
+
 /* Change this value to set camera sensitivity */
 #define CAMERA_SENSITIVITY 1
 
@@ -33,23 +45,25 @@ WARNING: Use odd numbers
 #define MAZE_HEIGHT 11
 
 /*
-Change this value to generate maze from a seed.
-If it is commented, the seed will be generated randomly
+Change this value to seed Wilson's algorithm with an Aldous-Broder walk over this share of the cells (0 to 1)
+It makes the slow first walks shorter but the mazes are no longer exactly uniform, 0 disables it
 */
-//#define MAZE_SEED 0
+#define WILSON_ALDOUS_BRODER_FRACTION 0.0
 
 /*
-Change this value to 
-WARNING: Works only if maze is being generated randomly,
-	DON'T UNCOMMENT THIS IF YOU ARE USING RANDOM GENERATION
+Change these values to set the cell selection of the growing tree generator
+Policies: Newest, Oldest, Random, Mixed (newest with the given weight, random otherwise)
+*/
+#define GROWING_TREE_POLICY Utils::GrowingTreePolicy::Mixed
+#define GROWING_TREE_NEWEST_WEIGHT 0.5
 
-WARNING: Making it more than 9 might make app unstable,
-	because, seed is an unsigned int, and max value of it is 4294967295 which is a 10 digid value,
-	which can be fault as an overflow
+/*
+Change these values to set the cell costs added with W, costs come from a noise field seeded by the maze seed
+Feature size is the width of the mud and water patches in cells, costs are between 1 and the max cost (at most 255)
 */
-#define MAZE_SEED_RIGID_COUNT 9
+#define CELL_COST_FEATURE_SIZE 8
+#define MAX_CELL_COST 9
 
 /* ------- DEBUG ------- */
 
-//#define DEBUG_CLEAR_COLOR // Uncomment this line to enable debug clear color (red) during rendering.
-//#define DEBUG_PRINT_MAZE_ON_CONSOLE // Uncomment this line to print maze into console after generation (might not work with large mazes)
\ No newline at end of file
+//#define DEBUG_CLEAR_COLOR // Uncomment this line to enable debug clear color (red) during rendering.
\ No newline at end of file
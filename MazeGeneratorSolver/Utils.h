@@ -1,116 +0,0 @@
-#pragma once
-
-#include <utility>
-#include <vector>
-#include <iostream>
-
-namespace Utils {
-	enum class Phase
-	{
-		Idle,
-		Generation,
-		CellSelection,
-		Solving,
-		Completed
-	};
-
-	inline Phase GetNextPhase(Phase currentPhase) {
-		return static_cast<Phase>((static_cast<int>(currentPhase) + 1) % 5);
-	}
-
-	enum class SelectionPhase
-	{
-		SelectingStart,
-		SelectingEnd
-	};
-
-	typedef std::pair<int, int> Direction; //Just more readable :)
-	inline Direction GetDirection(int index) {
-		Direction Directions[] = {
-			{ 0, -1 }, // Up
-			{ 0, 1 },  // Down
-			{ -1, 0 }, // Left
-			{ 1, 0 }   // Right
-		};
-		return Directions[index];
-	}
-	inline Direction GetInvertedDirection(Direction& direction) {
-		return Direction{ direction.first * -1, direction.second * -1 };
-	}
-
-	struct Cell {
-		int x = 0;
-		int y = 0;
-		bool isWall = true;
-
-		inline Cell operator+=(const Cell& current) {
-			Cell cell;
-			cell.x = x + current.x;
-			cell.y = y + current.y;
-			cell.isWall = current.isWall;
-			return cell;
-		}
-		inline bool operator==(const Cell& other) const {
-			return x == other.x && y == other.y;
-		}
-		inline bool operator!=(const Cell& other) const {
-			return !(*this == other);
-		}
-	};
-
-	struct Entrance {
-		std::shared_ptr<Cell> cell;
-		int passCount = 1;
-
-		Entrance(std::shared_ptr<Cell> cell) : cell(cell) {}
-	};
-
-	inline int GetPassCount(const std::vector<std::shared_ptr<Entrance>>& entrances, std::shared_ptr<Cell> cell) {
-		for (const auto& entrance : entrances) {
-			if (entrance->cell == cell) {
-				return entrance->passCount;
-			}
-		}
-		return 0;
-	}
-
-	inline void PassOnEntrance(std::vector<std::shared_ptr<Entrance>>& entrances, std::shared_ptr<Cell> cell) {
-		for (auto& entrance : entrances) {
-			if (entrance->cell == cell) {
-				entrance->passCount++;
-				return;
-			}
-		}
-		entrances.push_back(std::make_shared<Entrance>(cell));
-	}
-
-	inline bool IsPassedEntrance(const std::vector<std::shared_ptr<Entrance>>& entrances, std::shared_ptr<Cell> cell) {
-		for (const auto& entrance : entrances) {
-			if (entrance->cell == cell) {
-				return true;
-			}
-		}
-		return false;
-	}
-
-	inline bool IsOncePassedEntrance(const std::vector<std::shared_ptr<Entrance>>& entrances, std::shared_ptr<Cell> cell) {
-		for (const auto& entrance : entrances) {
-			if (entrance->cell == cell && entrance->passCount == 1) {
-				return true;
-			}
-		}
-		return false;
-	}
-
-	inline std::vector<std::shared_ptr<Entrance>> GetOncePassedEntrances(const std::vector<std::shared_ptr<Entrance>>& entrances) {
-		std::vector<std::shared_ptr<Entrance>> oncePassedEntrances;
-
-		for (const auto& entrance : entrances) {
-			if (entrance->passCount == 1) {
-				oncePassedEntrances.push_back(entrance);
-			}
-		}
-
-		return oncePassedEntrances;
-	}
-}
\ No newline at end of file
@@ -0,0 +1,1084 @@
+/*
+
+Checks of the maze core library, run by ctest. Every check prints what failed and the program returns 1 if any check failed.
+Generated mazes must be perfect: every lattice cell (odd x, odd y) is open, the outer border is closed,
+all open cells are connected and there are no loops, so open neighbor pairs are one less than the open cells.
+
+*/
+
+#include "Maze.h"
+#include "BreadthFirstSolver.h"
+#include "AStarSolver.h"
+#include "BidirectionalSolver.h"
+#include "JunctionGraph.h"
+#include "TreePathOracle.h"
+#include "ParallelBreadthFirstSolver.h"
+#include "BitboardSolver.h"
+#include "DeadEndSolver.h"
+#include "DistanceField.h"
+#include "LpaStarSolver.h"
+#include "HierarchicalPathfinder.h"
+#include "ExitField.h"
+#include "DijkstraSolver.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <functional>
+#include <queue>
+
+static int checkCount = 0;
+static int failedCheckCount = 0;
+
+static void Check(bool condition, const std::string& description)
+{
+	checkCount++;
+
+	if (condition)
+		return;
+
+	failedCheckCount++;
+	std::cerr << "FAILED: " << description << "\n";
+}
+
+/*
+PURPOSE: Checks that the maze is perfect, <description> names the maze in the failure messages
+*/
+static void CheckPerfectMaze(const Maze& maze, const std::string& description)
+{
+	const int width = maze.GetWidth();
+	const int height = maze.GetHeight();
+
+	bool borderClosed = true;
+	bool latticeOpen = true;
+	bool cornersClosed = true;
+	int openCellCount = 0;
+	int edgeCount = 0;
+	Utils::CellIndex firstOpenCell = Utils::INVALID_CELL;
+
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			Utils::CellIndex cell = maze.GetCellFromXY(x, y);
+			bool open = !maze.IsWall(cell);
+
+			if (x == 0 || y == 0 || x == width - 1 || y == height - 1)
+				borderClosed = borderClosed && !open;
+			if (x % 2 == 1 && y % 2 == 1)
+				latticeOpen = latticeOpen && open;
+			if (x % 2 == 0 && y % 2 == 0)
+				cornersClosed = cornersClosed && !open;
+
+			if (!open)
+				continue;
+
+			openCellCount++;
+			if (firstOpenCell == Utils::INVALID_CELL)
+				firstOpenCell = cell;
+
+			/* Every open pair is counted once, from its left or upper cell */
+			if (x + 1 < width && !maze.IsWall(cell + 1))
+				edgeCount++;
+			if (y + 1 < height && !maze.IsWall(cell + width))
+				edgeCount++;
+		}
+	}
+
+	/* Breadth first search over the open cells */
+	std::vector<uint8_t> reached(maze.GetCellCount(), 0);
+	std::vector<Utils::CellIndex> queue;
+	int reachedCount = 0;
+
+	if (firstOpenCell != Utils::INVALID_CELL) {
+		reached[firstOpenCell] = 1;
+		queue.push_back(firstOpenCell);
+	}
+
+	for (size_t i = 0; i < queue.size(); ++i) {
+		Utils::CellIndex cell = queue[i];
+		reachedCount++;
+
+		const int x = maze.GetCellX(cell);
+		const Utils::CellIndex neighbors[4] = {
+			cell >= width ? cell - width : Utils::INVALID_CELL,
+			cell + width < maze.GetCellCount() ? cell + width : Utils::INVALID_CELL,
+			x > 0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (const auto& neighbor : neighbors) {
+			if (neighbor == Utils::INVALID_CELL || reached[neighbor] || maze.IsWall(neighbor))
+				continue;
+
+			reached[neighbor] = 1;
+			queue.push_back(neighbor);
+		}
+	}
+
+	Check(borderClosed, description + ": outer border is closed");
+	Check(latticeOpen, description + ": every lattice cell is open");
+	Check(cornersClosed, description + ": cells between four lattice cells are walls");
+	Check(reachedCount == openCellCount, description + ": open cells are connected (" + std::to_string(reachedCount) + " of " + std::to_string(openCellCount) + " reached)");
+	Check(edgeCount == openCellCount - 1, description + ": no loops (" + std::to_string(edgeCount) + " open pairs for " + std::to_string(openCellCount) + " open cells)");
+}
+
+static std::string GetSizeName(int width, int height)
+{
+	return std::to_string(width) + "x" + std::to_string(height);
+}
+
+static void RunGeneration(Maze& maze)
+{
+	while (!maze.IsGenerationComplete())
+		maze.UpdateGeneration();
+}
+
+static void CheckBacktrackerGenerator()
+{
+	const int sizes[][2] = { { 3, 3 }, { 41, 31 }, { 5, 41 }, { 41, 5 }, { 100, 60 } };
+
+	for (const auto& size : sizes) {
+		Maze maze(size[0], size[1], 7);
+		maze.GenerateMaze();
+		RunGeneration(maze);
+
+		CheckPerfectMaze(maze, "Backtracker " + GetSizeName(size[0], size[1]));
+	}
+}
+
+/*
+PURPOSE: A maze generated again with another seed must be the maze a new maze of that seed generates, nothing of the last run may stay
+*/
+static void CheckSeededGeneration()
+{
+	Maze maze(41, 31, 1);
+	maze.GenerateMaze();
+	RunGeneration(maze);
+
+	maze.SelectSolveCells(maze.GetCellFromXY(1, 1), maze.GetCellFromXY(39, 29));
+	maze.SolveMaze();
+	while (!maze.IsSolvingComplete())
+		maze.UpdateSolving();
+
+	maze.SetSeed(2);
+	maze.GenerateMaze();
+	RunGeneration(maze);
+
+	Maze freshMaze(41, 31, 2);
+	freshMaze.GenerateMaze();
+	RunGeneration(freshMaze);
+
+	bool sameCells = std::equal(maze.GetCellData(), maze.GetCellData() + maze.GetCellCount(), freshMaze.GetCellData());
+
+	Check(sameCells, "Generating again with seed 2 gives the maze of a new maze with seed 2");
+	Check(!maze.HasSolveStartCell() && !maze.HasSolveEndCell() && maze.GetSolvePath().empty(), "Generating again drops the selected cells and the solve path");
+	CheckPerfectMaze(maze, "Backtracker generated again");
+}
+
+/*
+PURPOSE: Tiled generation on grids one tile wide and one tile tall too, stacked tiles of those have indices differing by 1
+*/
+static void CheckTiledGenerator()
+{
+	const int cases[][3] = {
+		{ 101, 1001, 64 }, { 1001, 101, 64 }, { 3, 41, 1 }, { 41, 3, 1 }, { 4, 6, 1 },
+		{ 3, 3, 1 }, { 41, 31, 4 }, { 41, 31, 100 }, { 257, 129, 16 }, { 21, 201, 3 }
+	};
+
+	for (const auto& testCase : cases) {
+		for (int threadCount = 1; threadCount <= 3; threadCount += 2) {
+			Maze maze(testCase[0], testCase[1], 19);
+			maze.GenerateMazeTiled(testCase[2], threadCount);
+
+			CheckPerfectMaze(maze, "Tiled " + GetSizeName(testCase[0], testCase[1]) + " tile " + std::to_string(testCase[2]) + " threads " + std::to_string(threadCount));
+		}
+	}
+}
+
+/*
+PURPOSE: Tiled mazes depend on the seed and the tile size only, every thread count (0 is all cores) must give the same cells
+*/
+static void CheckTiledDeterminism()
+{
+	Maze referenceMaze(201, 151, 23);
+	referenceMaze.GenerateMazeTiled(8, 1);
+
+	for (int threadCount = 0; threadCount <= 4; ++threadCount) {
+		Maze maze(201, 151, 23);
+		maze.GenerateMazeTiled(8, threadCount);
+
+		bool sameCells = std::equal(maze.GetCellData(), maze.GetCellData() + maze.GetCellCount(), referenceMaze.GetCellData());
+		Check(sameCells, "Tiled 201x151 tile 8 with " + std::to_string(threadCount) + " threads gives the cells of 1 thread");
+	}
+}
+
+static void CheckEllerGenerator()
+{
+	const int sizes[][2] = { { 3, 3 }, { 41, 31 }, { 5, 41 }, { 41, 5 }, { 100, 60 }, { 1001, 3 } };
+
+	for (const auto& size : sizes) {
+		for (uint64_t seed = 17; seed < 20; ++seed) {
+			Maze maze(size[0], size[1], seed);
+			maze.GenerateMazeEller();
+
+			CheckPerfectMaze(maze, "Eller " + GetSizeName(size[0], size[1]) + " seed " + std::to_string(seed));
+		}
+	}
+}
+
+/*
+PURPOSE: Kruskal mazes on several thread counts, the walls are shuffled in parallel but the maze must not depend on the thread count
+*/
+static void CheckKruskalGenerator()
+{
+	const int sizes[][2] = { { 3, 3 }, { 41, 31 }, { 5, 41 }, { 41, 5 }, { 100, 60 }, { 301, 201 } };
+
+	for (const auto& size : sizes) {
+		std::vector<uint8_t> referenceCells;
+
+		for (int threadCount = 1; threadCount <= 4; ++threadCount) {
+			Maze maze(size[0], size[1], 7);
+			maze.SetGenerationAlgorithm(Utils::GenerationAlgorithm::Kruskal);
+			maze.SetGenerationThreadCount(threadCount);
+			maze.GenerateMaze();
+			RunGeneration(maze);
+
+			const std::string description = "Kruskal " + GetSizeName(size[0], size[1]) + " threads " + std::to_string(threadCount);
+			CheckPerfectMaze(maze, description);
+
+			if (referenceCells.empty())
+				referenceCells.assign(maze.GetCellData(), maze.GetCellData() + maze.GetCellCount());
+			else
+				Check(std::equal(referenceCells.begin(), referenceCells.end(), maze.GetCellData()), description + ": same cells as 1 thread");
+		}
+	}
+}
+
+static void CheckWilsonGenerator()
+{
+	const int sizes[][2] = { { 3, 3 }, { 41, 31 }, { 5, 41 }, { 41, 5 }, { 100, 60 } };
+	const float aldousBroderFractions[] = { 0.0f, 0.5f, 1.0f };
+
+	for (const auto& size : sizes) {
+		for (const auto& fraction : aldousBroderFractions) {
+			Maze maze(size[0], size[1], 13);
+			maze.SetGenerationAlgorithm(Utils::GenerationAlgorithm::Wilson);
+			maze.SetAldousBroderFraction(fraction);
+			maze.GenerateMaze();
+			RunGeneration(maze);
+
+			CheckPerfectMaze(maze, "Wilson " + GetSizeName(size[0], size[1]) + " Aldous-Broder fraction " + std::to_string(fraction));
+		}
+	}
+}
+
+static void CheckGrowingTreeGenerator()
+{
+	const int sizes[][2] = { { 3, 3 }, { 41, 31 }, { 5, 41 }, { 41, 5 }, { 100, 60 } };
+
+	const Utils::GrowingTreePolicy policies[] = {
+		Utils::GrowingTreePolicy::Newest, Utils::GrowingTreePolicy::Oldest,
+		Utils::GrowingTreePolicy::Random, Utils::GrowingTreePolicy::Mixed
+	};
+	const float newestWeights[] = { 0.1f, 0.5f, 0.9f };
+
+	for (const auto& size : sizes) {
+		for (const auto& policy : policies) {
+			for (const auto& weight : newestWeights) {
+				Maze maze(size[0], size[1], 11);
+				maze.SetGenerationAlgorithm(Utils::GenerationAlgorithm::GrowingTree);
+				maze.SetGrowingTreePolicy(policy, weight);
+				maze.GenerateMaze();
+				RunGeneration(maze);
+
+				CheckPerfectMaze(maze, "GrowingTree policy " + std::to_string((int)policy) + " weight " + std::to_string(weight) + " " + GetSizeName(size[0], size[1]));
+
+				/* Only the mixed policy reads the weight */
+				if (policy != Utils::GrowingTreePolicy::Mixed)
+					break;
+			}
+		}
+	}
+}
+
+/*
+PURPOSE: Distances of every cell from <sourceCell> with a plain breadth first search, -1 for the cells which can't be reached
+*/
+static std::vector<int> GetReferenceDistances(const Maze& maze, Utils::CellIndex sourceCell)
+{
+	const int width = maze.GetWidth();
+
+	std::vector<int> distances(maze.GetCellCount(), -1);
+	std::vector<Utils::CellIndex> queue(1, sourceCell);
+	distances[sourceCell] = 0;
+
+	for (size_t i = 0; i < queue.size(); ++i) {
+		Utils::CellIndex cell = queue[i];
+		const int x = maze.GetCellX(cell);
+		const Utils::CellIndex neighbors[4] = {
+			cell >= width ? cell - width : Utils::INVALID_CELL,
+			cell + width < maze.GetCellCount() ? cell + width : Utils::INVALID_CELL,
+			x > 0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (const auto& neighbor : neighbors) {
+			if (neighbor == Utils::INVALID_CELL || distances[neighbor] >= 0 || maze.IsWall(neighbor))
+				continue;
+
+			distances[neighbor] = distances[cell] + 1;
+			queue.push_back(neighbor);
+		}
+	}
+
+	return distances;
+}
+
+/*
+PURPOSE: Checks that <path> goes from <startCell> to <endCell> through open neighbor cells with <expectedLength> moves
+*/
+static void CheckPath(const Maze& maze, const std::vector<Utils::CellIndex>& path, Utils::CellIndex startCell, Utils::CellIndex endCell, int expectedLength, const std::string& description)
+{
+	if (path.empty() || path.front() != startCell || path.back() != endCell) {
+		Check(false, description + ": path goes from the start cell to the end cell");
+		return;
+	}
+
+	bool connected = true;
+
+	for (size_t i = 0; i < path.size(); ++i) {
+		connected = connected && !maze.IsWall(path[i]);
+
+		if (i > 0) {
+			int dx = std::abs(maze.GetCellX(path[i]) - maze.GetCellX(path[i - 1]));
+			int dy = std::abs(maze.GetCellY(path[i]) - maze.GetCellY(path[i - 1]));
+			connected = connected && dx + dy == 1;
+		}
+	}
+
+	Check(connected, description + ": path moves between open neighbor cells");
+	Check((int)path.size() - 1 == expectedLength, description + ": path length " + std::to_string((int)path.size() - 1) + " is the shortest " + std::to_string(expectedLength));
+}
+
+/*
+PURPOSE: Generates a Kruskal maze, a share of <loopFraction> of the inner walls is opened to make loops
+*/
+static std::unique_ptr<Maze> CreateSolvingMaze(int width, int height, uint64_t seed, float loopFraction)
+{
+	auto maze = std::make_unique<Maze>(width, height, seed);
+	maze->SetGenerationAlgorithm(Utils::GenerationAlgorithm::Kruskal);
+	maze->GenerateMaze();
+	RunGeneration(*maze);
+
+	Random random(seed + 1);
+	int openedWallCount = (int)(loopFraction * maze->GetCellCount());
+
+	for (int i = 0; i < openedWallCount; ++i) {
+		/* Separate statements, argument evaluation order differs between compilers */
+		int x = 1 + random.NextInt(maze->GetWidth() - 2);
+		int y = 1 + random.NextInt(maze->GetHeight() - 2);
+
+		maze->SetWall(maze->GetCellFromXY(x, y), false);
+	}
+
+	return maze;
+}
+
+/*
+PURPOSE: Random open start and end cell pairs, the same pairs for the same seed
+*/
+static std::vector<std::pair<Utils::CellIndex, Utils::CellIndex>> GetCellPairs(const Maze& maze, int pairCount, uint64_t seed)
+{
+	Random random(seed);
+	std::vector<Utils::CellIndex> openCells;
+
+	for (Utils::CellIndex cell = 0; cell < maze.GetCellCount(); ++cell) {
+		if (!maze.IsWall(cell))
+			openCells.push_back(cell);
+	}
+
+	std::vector<std::pair<Utils::CellIndex, Utils::CellIndex>> pairs;
+
+	for (int i = 0; i < pairCount; ++i) {
+		Utils::CellIndex startCell = openCells[random.NextInt((int)openCells.size())];
+		Utils::CellIndex endCell = openCells[random.NextInt((int)openCells.size())];
+		pairs.push_back({ startCell, endCell });
+	}
+
+	return pairs;
+}
+
+/*
+PURPOSE: Kruskal maze with walls around one cell in the middle, the pair of cells returned can't be joined
+*/
+static std::unique_ptr<Maze> CreateEnclosedEndMaze(Utils::CellIndex& startCell, Utils::CellIndex& endCell)
+{
+	std::unique_ptr<Maze> maze = CreateSolvingMaze(41, 31, 37, 0.05f);
+	const int width = maze->GetWidth();
+
+	startCell = maze->GetCellFromXY(1, 1);
+	endCell = maze->GetCellFromXY(21, 15);
+
+	maze->SetWall(endCell, false);
+	maze->SetWall(endCell - width, true);
+	maze->SetWall(endCell + width, true);
+	maze->SetWall(endCell - 1, true);
+	maze->SetWall(endCell + 1, true);
+
+	return maze;
+}
+
+/*
+PURPOSE: Runs a step solver with Solve() and with Start() and Step() on a perfect maze and on a maze with loops,
+	paths must be as long as the reference search and an enclosed end cell must have no path.
+	One solver answers every pair of a maze, so resetting only what the last search reached is covered too.
+*/
+static void CheckStepSolver(const std::string& name, const std::function<std::unique_ptr<StepSolver>(const Maze&)>& createSolver)
+{
+	const float loopFractions[2] = { 0.0f, 0.08f };
+
+	for (const auto& loopFraction : loopFractions) {
+		std::unique_ptr<Maze> maze = CreateSolvingMaze(61, 41, 41, loopFraction);
+		std::unique_ptr<StepSolver> solver = createSolver(*maze);
+		const std::string mazeName = loopFraction > 0.0f ? " loops 61x41 " : " perfect 61x41 ";
+
+		for (const auto& [startCell, endCell] : GetCellPairs(*maze, 12, 23)) {
+			const int expectedLength = GetReferenceDistances(*maze, startCell)[endCell];
+			const std::string description = name + mazeName + std::to_string(startCell) + "->" + std::to_string(endCell);
+
+			Check(solver->Solve(startCell, endCell), description + ": path is found");
+			CheckPath(*maze, solver->GetPath(), startCell, endCell, expectedLength, description);
+
+			solver->Start(startCell, endCell);
+			while (solver->Step());
+
+			Check(solver->IsPathFound(), description + " stepped: path is found");
+			CheckPath(*maze, solver->GetPath(), startCell, endCell, expectedLength, description + " stepped");
+		}
+	}
+
+	Utils::CellIndex startCell;
+	Utils::CellIndex endCell;
+	std::unique_ptr<Maze> enclosedMaze = CreateEnclosedEndMaze(startCell, endCell);
+	std::unique_ptr<StepSolver> solver = createSolver(*enclosedMaze);
+
+	Check(!solver->Solve(startCell, endCell) && solver->GetPath().empty(), name + ": no path to an enclosed cell");
+}
+
+static void CheckBreadthFirstSolver()
+{
+	CheckStepSolver("BreadthFirst", [](const Maze& maze) { return std::make_unique<BreadthFirstSolver>(maze); });
+}
+
+static void CheckAStarSolver()
+{
+	CheckStepSolver("AStar", [](const Maze& maze) { return std::make_unique<AStarSolver>(maze); });
+}
+
+static void CheckBidirectionalSolver()
+{
+	CheckStepSolver("Bidirectional", [](const Maze& maze) { return std::make_unique<BidirectionalSolver>(maze); });
+}
+
+/*
+PURPOSE: Graph paths must be as long as the reference search, corridor cells as endpoints included.
+	Corridors of a perfect maze contract into a tree, so it has one edge less than nodes.
+*/
+static void CheckJunctionGraph()
+{
+	const float loopFractions[2] = { 0.0f, 0.08f };
+
+	for (const auto& loopFraction : loopFractions) {
+		std::unique_ptr<Maze> maze = CreateSolvingMaze(61, 41, 43, loopFraction);
+		const std::string mazeName = loopFraction > 0.0f ? "JunctionGraph loops 61x41 " : "JunctionGraph perfect 61x41 ";
+
+		JunctionGraph junctionGraph(*maze);
+		junctionGraph.Build();
+
+		if (loopFraction == 0.0f)
+			Check(junctionGraph.GetEdgeCount() == junctionGraph.GetNodeCount() - 1, mazeName + ": graph is a tree");
+
+		for (const auto& [startCell, endCell] : GetCellPairs(*maze, 12, 29)) {
+			const std::string description = mazeName + std::to_string(startCell) + "->" + std::to_string(endCell);
+			std::vector<Utils::CellIndex> path;
+
+			Check(junctionGraph.Solve(startCell, endCell, path), description + ": path is found");
+			CheckPath(*maze, path, startCell, endCell, GetReferenceDistances(*maze, startCell)[endCell], description);
+		}
+	}
+
+	Utils::CellIndex startCell;
+	Utils::CellIndex endCell;
+	std::unique_ptr<Maze> enclosedMaze = CreateEnclosedEndMaze(startCell, endCell);
+	JunctionGraph junctionGraph(*enclosedMaze);
+	junctionGraph.Build();
+
+	std::vector<Utils::CellIndex> path;
+	Check(!junctionGraph.Solve(startCell, endCell, path), "JunctionGraph: no path to an enclosed cell");
+}
+
+/*
+PURPOSE: Distances and paths of the oracle must match the reference search on perfect mazes,
+	the tour is long enough for many blocks, so queries use the sparse table. Mazes with loops are refused.
+*/
+static void CheckTreePathOracle()
+{
+	std::unique_ptr<Maze> maze = CreateSolvingMaze(101, 81, 47, 0.0f);
+	TreePathOracle treePathOracle(*maze);
+
+	Check(treePathOracle.Build() && treePathOracle.IsTree(), "TreePathOracle perfect 101x81: builds");
+
+	for (const auto& [startCell, endCell] : GetCellPairs(*maze, 16, 31)) {
+		const int expectedLength = GetReferenceDistances(*maze, startCell)[endCell];
+		const std::string description = "TreePathOracle perfect 101x81 " + std::to_string(startCell) + "->" + std::to_string(endCell);
+		std::vector<Utils::CellIndex> path;
+
+		Check(treePathOracle.GetDistance(startCell, endCell) == expectedLength, description + ": distance is the shortest");
+		Check(treePathOracle.GetPath(startCell, endCell, path), description + ": path is found");
+		CheckPath(*maze, path, startCell, endCell, expectedLength, description);
+	}
+
+	const Utils::CellIndex cell = maze->GetCellFromXY(1, 1);
+	Check(treePathOracle.GetDistance(cell, cell) == 0, "TreePathOracle perfect 101x81: distance of a cell to itself is 0");
+
+	std::unique_ptr<Maze> loopMaze = CreateSolvingMaze(61, 41, 47, 0.08f);
+	TreePathOracle loopOracle(*loopMaze);
+	const Utils::CellIndex loopCell = loopMaze->GetCellFromXY(1, 1);
+
+	Check(!loopOracle.Build(), "TreePathOracle loops 61x41: doesn't build");
+	Check(loopOracle.GetDistance(loopCell, loopMaze->GetCellFromXY(3, 1)) == -1, "TreePathOracle loops 61x41: queries are refused");
+}
+
+static void CheckParallelBreadthFirstSolver()
+{
+	CheckStepSolver("ParallelBreadthFirst 1 thread", [](const Maze& maze) { return std::make_unique<ParallelBreadthFirstSolver>(maze, 1); });
+	CheckStepSolver("ParallelBreadthFirst 3 threads", [](const Maze& maze) { return std::make_unique<ParallelBreadthFirstSolver>(maze, 3); });
+}
+
+/*
+PURPOSE: Bitboard paths and layer counts must match the reference search, the widths put the last open cells on both sides of word boundaries
+*/
+static void CheckBitboardSolver()
+{
+	CheckStepSolver("Bitboard", [](const Maze& maze) { return std::make_unique<BitboardSolver>(maze); });
+
+	const int widths[5] = { 63, 65, 127, 129, 257 };
+
+	for (int i = 0; i < 5; ++i) {
+		const float loopFraction = (i % 2) ? 0.1f : 0.0f;
+		std::unique_ptr<Maze> maze = CreateSolvingMaze(widths[i], 33, 53 + i, loopFraction);
+		BitboardSolver solver(*maze);
+
+		for (const auto& [startCell, endCell] : GetCellPairs(*maze, 8, 59 + i)) {
+			const int expectedLength = GetReferenceDistances(*maze, startCell)[endCell];
+			const std::string description = "Bitboard " + GetSizeName(maze->GetWidth(), maze->GetHeight()) + " " + std::to_string(startCell) + "->" + std::to_string(endCell);
+
+			Check(solver.Solve(startCell, endCell), description + ": path is found");
+			Check(solver.GetLayerCount() == expectedLength, description + ": layer count is the distance");
+			CheckPath(*maze, solver.GetPath(), startCell, endCell, expectedLength, description);
+		}
+	}
+}
+
+/*
+PURPOSE: Dead end filling keeps only the path open on a perfect maze, so its path must be the breadth first path cell by cell,
+	whether the corridors are filled on all threads or stepped
+*/
+static void CheckDeadEndSolver()
+{
+	CheckStepSolver("DeadEndFilling 1 thread", [](const Maze& maze) { return std::make_unique<DeadEndSolver>(maze, 1); });
+	CheckStepSolver("DeadEndFilling 3 threads", [](const Maze& maze) { return std::make_unique<DeadEndSolver>(maze, 3); });
+
+	std::unique_ptr<Maze> maze = CreateSolvingMaze(81, 61, 61, 0.0f);
+	DeadEndSolver solver(*maze, 3);
+	BreadthFirstSolver referenceSolver(*maze);
+
+	for (const auto& [startCell, endCell] : GetCellPairs(*maze, 10, 67)) {
+		const std::string description = "DeadEndFilling perfect 81x61 " + std::to_string(startCell) + "->" + std::to_string(endCell);
+
+		referenceSolver.Solve(startCell, endCell);
+
+		solver.Solve(startCell, endCell);
+		Check(solver.GetPath() == referenceSolver.GetPath(), description + ": path is the breadth first path");
+
+		solver.Start(startCell, endCell);
+		while (solver.Step());
+		Check(solver.GetPath() == referenceSolver.GetPath(), description + " stepped: path is the breadth first path");
+	}
+}
+
+/*
+PURPOSE: Every distance of the field must match the reference search, walls and the enclosed cell included.
+	On a perfect maze the double search must find the real diameter, found here by searching from every open cell.
+*/
+static void CheckDistanceField()
+{
+	std::unique_ptr<Maze> maze = CreateSolvingMaze(41, 31, 71, 0.0f);
+	DistanceField distanceField(*maze);
+
+	for (const auto& [sourceCell, otherCell] : GetCellPairs(*maze, 4, 73)) {
+		distanceField.Compute(sourceCell);
+
+		const std::vector<int> expectedDistances = GetReferenceDistances(*maze, sourceCell);
+		const int expectedMax = *std::max_element(expectedDistances.begin(), expectedDistances.end());
+		const std::string description = "DistanceField perfect 41x31 from " + std::to_string(sourceCell);
+
+		Check(distanceField.GetDistances() == expectedDistances, description + ": distances match the reference");
+		Check(distanceField.GetMaxDistance() == expectedMax, description + ": max distance");
+		Check(expectedDistances[distanceField.GetFarthestCell()] == expectedMax, description + ": farthest cell is at the max distance");
+	}
+
+	int expectedDiameter = 0;
+	for (Utils::CellIndex cell = 0; cell < maze->GetCellCount(); ++cell) {
+		if (maze->IsWall(cell))
+			continue;
+
+		const std::vector<int> distances = GetReferenceDistances(*maze, cell);
+		expectedDiameter = std::max(expectedDiameter, *std::max_element(distances.begin(), distances.end()));
+	}
+
+	Utils::CellIndex cell0;
+	Utils::CellIndex cell1;
+	const int diameter = distanceField.FindDiameter(maze->GetCellFromXY(21, 15), cell0, cell1);
+
+	Check(diameter == expectedDiameter, "DistanceField perfect 41x31: diameter " + std::to_string(diameter) + " is " + std::to_string(expectedDiameter));
+	Check(GetReferenceDistances(*maze, cell0)[cell1] == diameter, "DistanceField perfect 41x31: diameter cells are that far apart");
+	Check(distanceField.GetSourceCell() == cell0, "DistanceField perfect 41x31: field stays computed from the first diameter cell");
+
+	Utils::CellIndex startCell;
+	Utils::CellIndex endCell;
+	std::unique_ptr<Maze> enclosedMaze = CreateEnclosedEndMaze(startCell, endCell);
+	DistanceField enclosedField(*enclosedMaze);
+	enclosedField.Compute(startCell);
+
+	Check(enclosedField.GetDistances() == GetReferenceDistances(*enclosedMaze, startCell), "DistanceField loops 41x31: distances match the reference");
+	Check(enclosedField.GetDistance(endCell) == -1, "DistanceField: an enclosed cell is unreachable");
+}
+
+/*
+PURPOSE: LPA* paths must be shortest after the first search and after every repair, walls are toggled one at a time
+	and repairs run with a small budget so they are split over several calls like the editing mode does.
+	An edit may cut the end cell off, then no path must be found until another edit joins it again.
+*/
+static void CheckLpaStarSolver()
+{
+	const float loopFractions[2] = { 0.0f, 0.08f };
+
+	for (const auto& loopFraction : loopFractions) {
+		std::unique_ptr<Maze> maze = CreateSolvingMaze(41, 31, 79, loopFraction);
+		const std::string mazeName = loopFraction > 0.0f ? "LpaStar loops 41x31 " : "LpaStar perfect 41x31 ";
+		LpaStarSolver solver(*maze);
+
+		for (const auto& [startCell, endCell] : GetCellPairs(*maze, 8, 83)) {
+			const std::string description = mazeName + std::to_string(startCell) + "->" + std::to_string(endCell);
+
+			Check(solver.Solve(startCell, endCell), description + ": path is found");
+			CheckPath(*maze, solver.GetPath(), startCell, endCell, GetReferenceDistances(*maze, startCell)[endCell], description);
+		}
+
+		const Utils::CellIndex startCell = maze->GetCellFromXY(1, 1);
+		const Utils::CellIndex endCell = maze->GetCellFromXY(maze->GetWidth() - 2, maze->GetHeight() - 2);
+		solver.Solve(startCell, endCell);
+
+		Random random(89);
+
+		for (int edit = 0; edit < 40; ++edit) {
+			/* Separate statements, argument evaluation order differs between compilers */
+			int x = 1 + random.NextInt(maze->GetWidth() - 2);
+			int y = 1 + random.NextInt(maze->GetHeight() - 2);
+			Utils::CellIndex cell = maze->GetCellFromXY(x, y);
+
+			if (cell == startCell || cell == endCell)
+				continue;
+
+			maze->SetWall(cell, !maze->IsWall(cell));
+			solver.UpdateCell(cell);
+			while (!solver.Repair(64));
+
+			const int expectedLength = GetReferenceDistances(*maze, startCell)[endCell];
+			const std::string description = mazeName + "edit " + std::to_string(edit);
+
+			Check(solver.IsPathFound() == (expectedLength >= 0), description + ": path is found only if the end cell is reachable");
+			if (expectedLength >= 0)
+				CheckPath(*maze, solver.GetPath(), startCell, endCell, expectedLength, description);
+		}
+	}
+
+	Utils::CellIndex startCell;
+	Utils::CellIndex endCell;
+	std::unique_ptr<Maze> enclosedMaze = CreateEnclosedEndMaze(startCell, endCell);
+	LpaStarSolver solver(*enclosedMaze);
+
+	Check(!solver.Solve(startCell, endCell), "LpaStar: no path to an enclosed cell");
+}
+
+/*
+PURPOSE: Distances and refined paths must match the reference search before and after walls are edited.
+	Closing cells makes clusters lose nodes, so the node ids of the last query go past the rebuilt graph, opening them adds nodes back.
+	Edited clusters are only marked dirty, the next query rebuilds them.
+*/
+static void CheckHierarchicalPathfinder()
+{
+	std::unique_ptr<Maze> maze = CreateSolvingMaze(65, 65, 97, 0.08f);
+	HierarchicalPathfinder pathfinder(*maze, 8, 2);
+	pathfinder.Build();
+
+	const auto pairs = GetCellPairs(*maze, 8, 101);
+	const Utils::CellIndex startCell = maze->GetCellFromXY(1, 1);
+	const Utils::CellIndex endCell = maze->GetCellFromXY(maze->GetWidth() - 2, maze->GetHeight() - 2);
+
+	auto CheckQueries = [&](const std::string& stage) {
+		for (const auto& [pairStart, pairEnd] : pairs) {
+			if (maze->IsWall(pairStart) || maze->IsWall(pairEnd))
+				continue;
+
+			const int expectedLength = GetReferenceDistances(*maze, pairStart)[pairEnd];
+			const std::string description = "HierarchicalPathfinder loops 65x65 " + stage + " " + std::to_string(pairStart) + "->" + std::to_string(pairEnd);
+			std::vector<Utils::CellIndex> path;
+
+			Check(pathfinder.FindDistance(pairStart, pairEnd) == expectedLength, description + ": distance is the shortest");
+			Check(pathfinder.RefinePath(path) == (expectedLength >= 0), description + ": path is refined only if there is one");
+			if (expectedLength >= 0)
+				CheckPath(*maze, path, pairStart, pairEnd, expectedLength, description);
+		}
+	};
+
+	CheckQueries("built");
+
+	/* Long query last, so the most nodes are reached when the graph shrinks */
+	pathfinder.FindDistance(startCell, endCell);
+	const size_t builtNodeCount = pathfinder.GetNodeCount();
+
+	Random random(103);
+	std::vector<Utils::CellIndex> closedCells;
+
+	for (int i = 0; i < 600; ++i) {
+		/* Separate statements, argument evaluation order differs between compilers */
+		int x = 1 + random.NextInt(maze->GetWidth() - 2);
+		int y = 1 + random.NextInt(maze->GetHeight() - 2);
+		Utils::CellIndex cell = maze->GetCellFromXY(x, y);
+
+		if (maze->IsWall(cell) || cell == startCell || cell == endCell)
+			continue;
+
+		maze->SetWall(cell, true);
+		pathfinder.MarkDirty(cell);
+		closedCells.push_back(cell);
+	}
+
+	std::vector<Utils::CellIndex> path;
+	Check(!pathfinder.RefinePath(path), "HierarchicalPathfinder loops 65x65: path of the old walls is dropped");
+
+	CheckQueries("closed");
+	Check(pathfinder.GetNodeCount() < builtNodeCount, "HierarchicalPathfinder loops 65x65: closing cells removes nodes");
+
+	pathfinder.FindDistance(startCell, endCell);
+
+	for (const auto& cell : closedCells) {
+		maze->SetWall(cell, false);
+		pathfinder.MarkDirty(cell);
+	}
+
+	CheckQueries("reopened");
+	Check(pathfinder.GetNodeCount() == builtNodeCount, "HierarchicalPathfinder loops 65x65: reopening cells restores the nodes");
+
+	Utils::CellIndex enclosedStart;
+	Utils::CellIndex enclosedEnd;
+	std::unique_ptr<Maze> enclosedMaze = CreateEnclosedEndMaze(enclosedStart, enclosedEnd);
+	HierarchicalPathfinder enclosedPathfinder(*enclosedMaze, 8, 2);
+	enclosedPathfinder.Build();
+
+	Check(enclosedPathfinder.FindDistance(enclosedStart, enclosedEnd) == -1, "HierarchicalPathfinder: no path to an enclosed cell");
+}
+
+/*
+PURPOSE: Batch results must match the reference search, the maze keeps one batch solver, so batches after the first reuse its scratch.
+	The solver is dropped when the grid is generated again or the thread count changes, later batches must answer for the new maze.
+*/
+static void CheckBatchSolver()
+{
+	const float loopFractions[2] = { 0.0f, 0.08f };
+
+	for (const auto& loopFraction : loopFractions) {
+		std::unique_ptr<Maze> maze = CreateSolvingMaze(61, 41, 107, loopFraction);
+		const std::string mazeName = loopFraction > 0.0f ? "BatchSolver loops 61x41 " : "BatchSolver perfect 61x41 ";
+
+		for (int batch = 0; batch < 4; ++batch) {
+			if (batch == 2)
+				maze->SetSolvingThreadCount(3);
+
+			if (batch == 3) {
+				maze->SetSeed(109);
+				maze->GenerateMaze();
+				RunGeneration(*maze);
+			}
+
+			const bool keepPaths = batch != 1;
+			std::vector<BatchSolver::Query> queries;
+
+			for (const auto& [startCell, endCell] : GetCellPairs(*maze, 40, 113 + batch))
+				queries.push_back({ startCell, endCell });
+
+			const std::vector<BatchSolver::Result> results = maze->SolveBatch(queries, keepPaths);
+
+			Check(results.size() == queries.size(), mazeName + "batch " + std::to_string(batch) + ": a result for every query");
+
+			for (size_t i = 0; i < results.size(); ++i) {
+				const int expectedLength = GetReferenceDistances(*maze, queries[i].startCell)[queries[i].endCell];
+				const std::string description = mazeName + "batch " + std::to_string(batch) + " " + std::to_string(queries[i].startCell) + "->" + std::to_string(queries[i].endCell);
+
+				Check(results[i].length == expectedLength, description + ": length is the shortest");
+
+				if (keepPaths) {
+					std::vector<Utils::CellIndex> path;
+					BatchSolver::DecodePath(*maze, queries[i], results[i], path);
+					CheckPath(*maze, path, queries[i].startCell, queries[i].endCell, expectedLength, description);
+				}
+			}
+		}
+	}
+
+	Utils::CellIndex startCell;
+	Utils::CellIndex endCell;
+	std::unique_ptr<Maze> enclosedMaze = CreateEnclosedEndMaze(startCell, endCell);
+	const BatchSolver::Query queries[2] = { { startCell, endCell }, { endCell, endCell } };
+	const std::vector<BatchSolver::Result> results = enclosedMaze->SolveBatch(queries);
+
+	Check(results[0].length == -1, "BatchSolver: no path to an enclosed cell");
+	Check(results[1].length == 0, "BatchSolver: an enclosed cell reaches itself");
+}
+
+/*
+PURPOSE: Every cell must be as far as its nearest exit by the reference search of each exit and owned by the first exit that near,
+	paths lead to the owner. A wall in the exit list owns nothing and the enclosed cell reaches no exit.
+*/
+static void CheckExitField()
+{
+	Utils::CellIndex startCell;
+	Utils::CellIndex enclosedCell;
+	std::unique_ptr<Maze> maze = CreateEnclosedEndMaze(startCell, enclosedCell);
+
+	const Utils::CellIndex exitCells[5] = {
+		startCell,
+		maze->GetCellFromXY(maze->GetWidth() - 2, 1),
+		maze->GetCellFromXY(0, 0), // Wall
+		maze->GetCellFromXY(1, maze->GetHeight() - 2),
+		maze->GetCellFromXY(maze->GetWidth() - 2, maze->GetHeight() - 2)
+	};
+
+	std::vector<std::vector<int>> exitDistances;
+	for (const auto& exitCell : exitCells)
+		exitDistances.push_back(maze->IsWall(exitCell) ? std::vector<int>(maze->GetCellCount(), -1) : GetReferenceDistances(*maze, exitCell));
+
+	ExitField exitField(*maze);
+	exitField.Compute(exitCells);
+
+	Check(exitField.IsComputed(), "ExitField: is computed");
+
+	int mismatchCount = 0;
+	int pathCount = 0;
+
+	for (Utils::CellIndex cell = 0; cell < maze->GetCellCount(); ++cell) {
+		int expectedDistance = -1;
+		int expectedOwner = -1;
+
+		for (int exit = 0; exit < 5; ++exit) {
+			const int distance = exitDistances[exit][cell];
+
+			if (distance >= 0 && (expectedDistance < 0 || distance < expectedDistance)) {
+				expectedDistance = distance;
+				expectedOwner = exit;
+			}
+		}
+
+		if (exitField.GetDistance(cell) != expectedDistance || exitField.GetOwner(cell) != expectedOwner) {
+			mismatchCount++;
+			continue;
+		}
+
+		/* Paths of a few cells, every cell would make the check slow */
+		if (expectedDistance < 0 || cell % 7 != 0)
+			continue;
+
+		std::vector<Utils::CellIndex> path;
+		Check(exitField.GetNearestPath(cell, path), "ExitField " + std::to_string(cell) + ": path is found");
+		CheckPath(*maze, path, cell, exitCells[expectedOwner], expectedDistance, "ExitField " + std::to_string(cell));
+		pathCount++;
+	}
+
+	Check(mismatchCount == 0, "ExitField: " + std::to_string(mismatchCount) + " cells with a wrong distance or owner");
+	Check(pathCount > 0, "ExitField: paths are checked");
+	Check(exitField.GetOwner(enclosedCell) == -1 && exitField.GetDistance(enclosedCell) == -1, "ExitField: enclosed cell reaches no exit");
+
+	std::vector<Utils::CellIndex> path;
+	Check(!exitField.GetNearestPath(enclosedCell, path), "ExitField: no path from the enclosed cell");
+}
+
+/*
+PURPOSE: Cheapest path costs of every cell from one source, a binary heap Dijkstra that the radix heap solver is checked against
+*/
+static std::vector<int64_t> GetReferenceCosts(const Maze& maze, Utils::CellIndex sourceCell)
+{
+	const int width = maze.GetWidth();
+
+	std::vector<int64_t> costs(maze.GetCellCount(), -1);
+	std::priority_queue<std::pair<int64_t, Utils::CellIndex>, std::vector<std::pair<int64_t, Utils::CellIndex>>, std::greater<>> openList;
+
+	costs[sourceCell] = 0;
+	openList.push({ 0, sourceCell });
+
+	while (!openList.empty()) {
+		auto [cost, cell] = openList.top();
+		openList.pop();
+
+		if (cost != costs[cell])
+			continue;
+
+		const int x = maze.GetCellX(cell);
+		const Utils::CellIndex neighbors[4] = {
+			cell >= width ? cell - width : Utils::INVALID_CELL,
+			cell + width < maze.GetCellCount() ? cell + width : Utils::INVALID_CELL,
+			x > 0 ? cell - 1 : Utils::INVALID_CELL,
+			x + 1 < width ? cell + 1 : Utils::INVALID_CELL
+		};
+
+		for (const auto& neighbor : neighbors) {
+			if (neighbor == Utils::INVALID_CELL || maze.IsWall(neighbor))
+				continue;
+
+			int64_t nextCost = cost + maze.GetCellCost(neighbor);
+
+			if (costs[neighbor] >= 0 && costs[neighbor] <= nextCost)
+				continue;
+
+			costs[neighbor] = nextCost;
+			openList.push({ nextCost, neighbor });
+		}
+	}
+
+	return costs;
+}
+
+/*
+PURPOSE: Without cell costs Dijkstra is checked like the other step solvers. With costs up to 9 and up to 255
+	the path cost must be the cheapest one, the path cells must add up to it, stepping must end with the same cost.
+*/
+static void CheckDijkstraSolver()
+{
+	CheckStepSolver("Dijkstra", [](const Maze& maze) { return std::make_unique<DijkstraSolver>(maze); });
+
+	std::unique_ptr<Maze> maze = CreateSolvingMaze(81, 61, 127, 0.1f);
+	const int maxCosts[2] = { 9, 255 };
+
+	for (const auto& maxCost : maxCosts) {
+		maze->GenerateCellCosts(6, maxCost);
+		DijkstraSolver solver(*maze);
+
+		for (const auto& [startCell, endCell] : GetCellPairs(*maze, 12, 131)) {
+			const int64_t expectedCost = GetReferenceCosts(*maze, startCell)[endCell];
+			const std::string description = "Dijkstra max cost " + std::to_string(maxCost) + " " + std::to_string(startCell) + "->" + std::to_string(endCell);
+
+			Check(solver.Solve(startCell, endCell), description + ": path is found");
+
+			const std::vector<Utils::CellIndex>& path = solver.GetPath();
+			int64_t pathCost = 0;
+			for (size_t i = 1; i < path.size(); ++i)
+				pathCost += maze->GetCellCost(path[i]);
+
+			Check(solver.GetPathCost() == expectedCost, description + ": cost " + std::to_string(solver.GetPathCost()) + " is the cheapest " + std::to_string(expectedCost));
+			Check(pathCost == expectedCost, description + ": path cells add up to the cost");
+			CheckPath(*maze, path, startCell, endCell, (int)path.size() - 1, description);
+
+			solver.Start(startCell, endCell);
+			while (solver.Step());
+			Check(solver.GetPathCost() == expectedCost, description + " stepped: cost is the cheapest");
+		}
+	}
+}
+
+/*
+PURPOSE: Solves through the maze like the visualizer does with Tremaux. Paths are unique on perfect mazes, so the completed path
+	must be the shortest one. The compact list of passed entrances must match the pass counters of the grid.
+*/
+static void CheckTremauxSolving()
+{
+	const Utils::GenerationAlgorithm algorithms[2] = { Utils::GenerationAlgorithm::Wilson, Utils::GenerationAlgorithm::Kruskal };
+
+	for (const auto& algorithm : algorithms) {
+		Maze maze(41, 31, 137);
+		maze.SetGenerationAlgorithm(algorithm);
+		maze.SetSolvingAlgorithm(Utils::SolvingAlgorithm::Tremaux);
+		maze.GenerateMaze();
+		RunGeneration(maze);
+
+		const Utils::CellIndex startCell = maze.GetCellFromXY(1, 1);
+		const Utils::CellIndex endCell = maze.GetCellFromXY(maze.GetWidth() - 2, maze.GetHeight() - 2);
+		const std::string description = "Tremaux " + std::to_string((int)algorithm);
+
+		maze.SelectSolveCells(startCell, endCell);
+		maze.SolveMaze();
+		while (!maze.IsSolvingComplete())
+			maze.UpdateSolving();
+
+		int passedCount = 0;
+		int maxPassCount = 0;
+
+		for (Utils::CellIndex cell = 0; cell < maze.GetCellCount(); ++cell) {
+			passedCount += maze.IsPassedEntrance(cell) ? 1 : 0;
+			maxPassCount = std::max(maxPassCount, maze.GetPassCount(cell));
+		}
+
+		const std::vector<Utils::CellIndex>& passedEntrances = maze.GetPassedEntrances();
+
+		Check(passedCount > 0 && passedCount == (int)passedEntrances.size(), description + ": passed entrance list holds every passed cell");
+		Check(std::all_of(passedEntrances.begin(), passedEntrances.end(), [&](Utils::CellIndex cell) { return maze.IsPassedEntrance(cell); }), description + ": passed entrance list holds only passed cells");
+		Check(maxPassCount < Utils::MAX_PASS_COUNT, description + ": pass counters don't saturate");
+
+		maze.CompleteMaze();
+		while (!maze.IsCompletionComplete())
+			maze.UpdateCompletion();
+
+		/* Solve path holds only the cells between start and end */
+		std::vector<Utils::CellIndex> path(1, startCell);
+		path.insert(path.end(), maze.GetSolvePath().begin(), maze.GetSolvePath().end());
+		path.push_back(endCell);
+
+		CheckPath(maze, path, startCell, endCell, GetReferenceDistances(maze, startCell)[endCell], description);
+	}
+}
+
+int main()
+{
+	CheckBacktrackerGenerator();
+	CheckSeededGeneration();
+	CheckTiledGenerator();
+	CheckTiledDeterminism();
+	CheckEllerGenerator();
+	CheckKruskalGenerator();
+	CheckWilsonGenerator();
+	CheckGrowingTreeGenerator();
+	CheckBreadthFirstSolver();
+	CheckAStarSolver();
+	CheckBidirectionalSolver();
+	CheckJunctionGraph();
+	CheckTreePathOracle();
+	CheckParallelBreadthFirstSolver();
+	CheckBitboardSolver();
+	CheckDeadEndSolver();
+	CheckDistanceField();
+	CheckLpaStarSolver();
+	CheckHierarchicalPathfinder();
+	CheckBatchSolver();
+	CheckExitField();
+	CheckDijkstraSolver();
+	CheckTremauxSolving();
+
+	if (failedCheckCount > 0) {
+		std::cerr << failedCheckCount << " of " << checkCount << " checks failed\n";
+		return 1;
+	}
+
+	std::cout << "All " << checkCount << " checks passed\n";
+	return 0;
+}